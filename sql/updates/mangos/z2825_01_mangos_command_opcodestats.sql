@@ -0,0 +1,6 @@
+ALTER TABLE db_version CHANGE COLUMN required_z2824_01_mangos_model_unification required_z2825_01_mangos_command_opcodestats bit;
+
+DELETE FROM command WHERE name IN ('server opcodestats');
+
+INSERT INTO `command`(`name`, `security`, `help`) VALUES
+('server opcodestats', 3, 'Syntax: .server opcodestats [#count|reset]\r\n\r\nShow the #count (default 10) opcodes with the highest total handler time since startup: handler calls, handler time (total, average, 95th percentile, max), wait time between receive and handler call (average, 95th percentile), received and sent packets and bytes, and session packet rate budget overruns. With reset clear all opcode statistics.');
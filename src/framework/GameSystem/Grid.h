@@ -36,18 +36,37 @@
 #include "TypeContainerVisitor.h"
 
 // forward declaration
-template<class A, class T, class O> class GridLoader;
+template<class A, class T, class O, class P> class GridLoader;
+
+/*
+  @class GridNoPositionIndex
+  Default position index policy of a grid: keeps nothing, so every visit walks the object lists.
+  A real policy is told about every object entering and leaving the grid and can take over
+  a visit (return true) for visitors able to use it.
+*/
+struct GridNoPositionIndex
+{
+    template<class SPECIFIC_OBJECT>
+    void Insert(SPECIFIC_OBJECT* /*obj*/, bool /*worldObject*/) {}
+
+    template<class SPECIFIC_OBJECT>
+    void Remove(SPECIFIC_OBJECT* /*obj*/) {}
+
+    template<class VISITOR>
+    bool Visit(VISITOR& /*visitor*/, bool /*worldObjects*/) const { return false; }
+};
 
 template
 <
     class ACTIVE_OBJECT,
     class WORLD_OBJECT_TYPES,
-    class GRID_OBJECT_TYPES
+    class GRID_OBJECT_TYPES,
+    class POSITION_INDEX = GridNoPositionIndex
     >
 class Grid
 {
         // allows the GridLoader to access its internals
-        template<class A, class T, class O> friend class GridLoader;
+        template<class A, class T, class O, class P> friend class GridLoader;
 
     public:
 
@@ -61,7 +80,11 @@ class Grid
         template<class SPECIFIC_OBJECT>
         bool AddWorldObject(SPECIFIC_OBJECT* obj)
         {
-            return i_objects.template insert<SPECIFIC_OBJECT>(obj);
+            if (!i_objects.template insert<SPECIFIC_OBJECT>(obj))
+                return false;
+
+            i_positionIndex.Insert(obj, true);
+            return true;
         }
 
         /** an object of interested exits the grid
@@ -69,6 +92,7 @@ class Grid
         template<class SPECIFIC_OBJECT>
         bool RemoveWorldObject(SPECIFIC_OBJECT* obj)
         {
+            i_positionIndex.Remove(obj);
             return i_objects.template remove<SPECIFIC_OBJECT>(obj);
         }
 
@@ -77,7 +101,8 @@ class Grid
         template<class T>
         void Visit(TypeContainerVisitor<T, TypeMapContainer<GRID_OBJECT_TYPES> >& visitor)
         {
-            visitor.Visit(i_container);
+            if (!i_positionIndex.Visit(visitor.GetVisitor(), false))
+                visitor.Visit(i_container);
         }
 
         /** Grid visitor for world objects
@@ -85,9 +110,12 @@ class Grid
         template<class T>
         void Visit(TypeContainerVisitor<T, TypeMapContainer<WORLD_OBJECT_TYPES> >& visitor)
         {
-            visitor.Visit(i_objects);
+            if (!i_positionIndex.Visit(visitor.GetVisitor(), true))
+                visitor.Visit(i_objects);
         }
 
+        POSITION_INDEX const& GetPositionIndex() const { return i_positionIndex; }
+
         /** Returns the number of object within the grid.
          */
         uint32 ActiveObjectsInGrid() const
@@ -103,7 +131,11 @@ class Grid
             if (obj->isActiveObject())
                 m_activeGridObjects.insert(obj);
 
-            return i_container.template insert<SPECIFIC_OBJECT>(obj);
+            if (!i_container.template insert<SPECIFIC_OBJECT>(obj))
+                return false;
+
+            i_positionIndex.Insert(obj, false);
+            return true;
         }
 
         /** Removes a containter type object from the grid
@@ -114,6 +146,7 @@ class Grid
             if (obj->isActiveObject())
                 m_activeGridObjects.erase(obj);
 
+            i_positionIndex.Remove(obj);
             return i_container.template remove<SPECIFIC_OBJECT>(obj);
         }
 
@@ -123,6 +156,7 @@ class Grid
         TypeMapContainer<WORLD_OBJECT_TYPES> i_objects;
         typedef std::set<void*> ActiveGridObjects;
         ActiveGridObjects m_activeGridObjects;
+        POSITION_INDEX i_positionIndex;
 };
 
 #endif
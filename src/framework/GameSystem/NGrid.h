@@ -78,13 +78,14 @@ template
     uint32 N,
     class ACTIVE_OBJECT,
     class WORLD_OBJECT_TYPES,
-    class GRID_OBJECT_TYPES
+    class GRID_OBJECT_TYPES,
+    class POSITION_INDEX = GridNoPositionIndex
     >
 class NGrid
 {
     public:
 
-        typedef Grid<ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> GridType;
+        typedef Grid<ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES, POSITION_INDEX> GridType;
 
         NGrid(uint32 id, uint32 x, uint32 y, time_t expiry, bool unload = true)
             : i_gridId(id), i_x(x), i_y(y), i_cellstate(GRID_STATE_INVALID), i_GridObjectDataLoaded(false)
@@ -112,7 +113,7 @@ class NGrid
         uint32 getX() const { return i_x; }
         uint32 getY() const { return i_y; }
 
-        void link(GridRefManager<NGrid<N, ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> >* pTo)
+        void link(GridRefManager<NGrid<N, ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES, POSITION_INDEX> >* pTo)
         {
             i_Reference.link(pTo, this);
         }
@@ -188,7 +189,7 @@ class NGrid
 
         uint32 i_gridId;
         GridInfo i_GridInfo;
-        GridReference<NGrid<N, ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> > i_Reference;
+        GridReference<NGrid<N, ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES, POSITION_INDEX> > i_Reference;
         uint32 i_x;
         uint32 i_y;
         grid_state_t i_cellstate;
@@ -85,6 +85,8 @@ class TypeContainerVisitor
             VisitorHelper(i_visitor, c);
         }
 
+        VISITOR& GetVisitor() const { return i_visitor; }
+
     private:
 
         VISITOR& i_visitor;
@@ -18,9 +18,12 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+
 EventProcessor::EventProcessor()
 {
     m_time = 0;
+    m_queueOrder = 0;
     m_aborting = false;
 }
 
@@ -35,12 +38,12 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.front().first <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        BasicEvent* Event = m_events.front().second;
+        std::pop_heap(m_events.begin(), m_events.end(), LaterEvent);
+        m_events.pop_back();
 
         if (!Event->to_Abort)
         {
@@ -63,39 +66,34 @@ void EventProcessor::KillAllEvents(bool force)
     // prevent event insertions
     m_aborting = true;
 
-    // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    // first, abort all existing events, keep only not deletable ones (in not force case)
+    // detach the list, Abort calls may modify the queue
+    EventList events;
+    events.swap(m_events);
+    std::sort(events.begin(), events.end(), [](std::pair<uint64, BasicEvent*> const& lhs, std::pair<uint64, BasicEvent*> const& rhs)
     {
-        EventList::iterator i_old = i;
-        ++i;
-
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
-        {
-            delete i_old->second;
-
-            if (!force)                                     // need per-element cleanup
-                m_events.erase(i_old);
-        }
+        return LaterEvent(rhs, lhs);
+    });
+    for (EventList::const_iterator i = events.begin(); i != events.end(); ++i)
+    {
+        i->second->to_Abort = true;
+        i->second->Abort(m_time);
+        if (force || i->second->IsDeletable())
+            delete i->second;
+        else
+            InsertEvent(i->second, i->first);
     }
-
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::KillEvent(BasicEvent* event)
 {
-    for (EventList::iterator iter = m_events.begin(); iter != m_events.end();)
-    {
-        if (iter->second == event)
-        {
-            delete iter->second;
-            iter = m_events.erase(iter);
-        }
-        else ++iter;
-    }
+    EventList::iterator itr = std::find_if(m_events.begin(), m_events.end(),
+        [event](std::pair<uint64, BasicEvent*> const& elem) { return elem.second == event; });
+    if (itr == m_events.end())
+        return;
+
+    delete itr->second;
+    RemoveEventAt(size_t(itr - m_events.begin()));
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
@@ -104,20 +102,62 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    InsertEvent(Event, e_time);
+}
+
+void EventProcessor::InsertEvent(BasicEvent* Event, uint64 e_time)
+{
+    Event->m_queueOrder = m_queueOrder++;
+    m_events.push_back(std::make_pair(e_time, Event));
+    std::push_heap(m_events.begin(), m_events.end(), LaterEvent);
+}
+
+bool EventProcessor::LaterEvent(std::pair<uint64, BasicEvent*> const& lhs, std::pair<uint64, BasicEvent*> const& rhs)
+{
+    if (lhs.first != rhs.first)
+        return lhs.first > rhs.first;
+    return lhs.second->m_queueOrder > rhs.second->m_queueOrder;
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* Event, uint64 msTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != Event)
-            continue;
+    EventList::iterator itr = std::find_if(m_events.begin(), m_events.end(),
+        [Event](std::pair<uint64, BasicEvent*> const& elem) { return elem.second == Event; });
+    if (itr == m_events.end())
+        return;
+
+    Event->m_execTime = msTime;
+    RemoveEventAt(size_t(itr - m_events.begin()));
+    InsertEvent(Event, msTime);
+}
+
+void EventProcessor::RemoveEventAt(size_t index)
+{
+    // the last event fills the hole and is moved up or down from there, O(log n) instead of a rebuild
+    size_t const last = m_events.size() - 1;
+    if (index != last)
+        m_events[index] = m_events[last];
+    m_events.pop_back();
+
+    if (index >= m_events.size())
+        return;
+
+    if (index > 0 && LaterEvent(m_events[(index - 1) / 2], m_events[index]))
+        std::push_heap(m_events.begin(), m_events.begin() + index + 1, LaterEvent);
+    else
+        SiftDown(index);
+}
 
-        Event->m_execTime = msTime;
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(msTime, Event));
-        break;
+void EventProcessor::SiftDown(size_t index)
+{
+    size_t const size = m_events.size();
+    for (size_t child = 2 * index + 1; child < size; index = child, child = 2 * index + 1)
+    {
+        if (child + 1 < size && LaterEvent(m_events[child], m_events[child + 1]))
+            ++child;
+        if (!LaterEvent(m_events[index], m_events[child]))
+            break;
+        std::swap(m_events[index], m_events[child]);
     }
 }
 
@@ -21,7 +21,9 @@
 
 #include "Platform/Define.h"
 
-#include <map>
+#include <new>
+#include <utility>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -53,9 +55,71 @@ class BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
+        uint64 m_queueOrder;                                // insertion order for events with same execution time, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Base for events scheduled very often (per relocation, per cast): memory of deleted events is
+// kept in a small per thread free list and reused by next allocation of same event type
+template<class T>
+class PooledBasicEvent : public BasicEvent
+{
+    public:
+        static void* operator new(size_t size)
+        {
+            FreeList* freeList = GetFreeList();
+            if (freeList && size == sizeof(T) && !freeList->blocks.empty())
+            {
+                void* block = freeList->blocks.back();
+                freeList->blocks.pop_back();
+                return block;
+            }
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* ptr, size_t size)
+        {
+            FreeList* freeList = GetFreeList();
+            if (freeList && size == sizeof(T) && freeList->blocks.size() < MAX_POOLED_EVENTS)
+                freeList->blocks.push_back(ptr);
+            else
+                ::operator delete(ptr);
+        }
+
+    private:
+        static size_t const MAX_POOLED_EVENTS = 512;
+
+        struct FreeList
+        {
+            ~FreeList()
+            {
+                for (void* block : blocks)
+                    ::operator delete(block);
+                blocks.clear();
+                Destroyed() = true;
+            }
+            std::vector<void*> blocks;
+        };
+
+        // events owned by other thread locals can be deleted after the free list is gone at thread exit,
+        // the flag is trivially destructible so it stays readable until the thread ends
+        static bool& Destroyed()
+        {
+            static thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        static FreeList* GetFreeList()
+        {
+            if (Destroyed())
+                return nullptr;
+            static thread_local FreeList freeList;
+            return &freeList;
+        }
+};
+
+// Binary min heap on execution time (earliest on top, see EventProcessor::LaterEvent), events with
+// equal time keep their insertion order. Iteration order of the container is unspecified.
+typedef std::vector<std::pair<uint64, BasicEvent*> > EventList;
 
 class EventProcessor
 {
@@ -70,11 +134,26 @@ class EventProcessor
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         void ModifyEventTime(BasicEvent* event, uint64 msTime);
         uint64 CalculateTime(uint64 t_offset) const;
-        EventList& GetEvents() { return m_events; }
+        bool HasEvents() const { return !m_events.empty(); }
+
+        // calls visitor(BasicEvent*) for each queued event, in unspecified order. The queue must not be
+        // changed from the visitor (adding, killing or rescheduling events reorders it), collect the events
+        // and act on them after the visit instead.
+        template<class Visitor>
+        void VisitEvents(Visitor&& visitor) const
+        {
+            for (EventList::const_iterator itr = m_events.begin(); itr != m_events.end(); ++itr)
+                visitor(itr->second);
+        }
 
     protected:
+        void InsertEvent(BasicEvent* Event, uint64 e_time);
+        void RemoveEventAt(size_t index);
+        void SiftDown(size_t index);
+        static bool LaterEvent(std::pair<uint64, BasicEvent*> const& lhs, std::pair<uint64, BasicEvent*> const& rhs);
 
         uint64 m_time;
+        uint64 m_queueOrder;
         EventList m_events;
         bool m_aborting;
 };
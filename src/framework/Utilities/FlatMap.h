@@ -0,0 +1,108 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_FLATMAP_H
+#define MANGOS_FLATMAP_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/*
+  @class FlatMap
+  Read-only (frozen) associative container stored as a key sorted contiguous array.
+  Intended for static data that is filled once at load from a std::map or std::multimap
+  and then only looked up: lookups are binary searches over a single cache friendly block
+  instead of walking tree nodes. Equal keys are allowed and keep the order of the source
+  container, so it can replace both std::map and std::multimap lookups (find/equal_range).
+ */
+template<typename KEY, typename VALUE>
+class FlatMap
+{
+    public:
+        typedef KEY key_type;
+        typedef VALUE mapped_type;
+        typedef std::pair<KEY, VALUE> value_type;
+        typedef std::vector<value_type> StorageType;
+        typedef typename StorageType::const_iterator const_iterator;
+        typedef typename StorageType::size_type size_type;
+
+        FlatMap() {}
+
+        // source must be iterable in key order (std::map/std::multimap)
+        template<class SOURCE>
+        explicit FlatMap(SOURCE const& source) { Assign(source); }
+
+        template<class SOURCE>
+        void Assign(SOURCE const& source)
+        {
+            m_storage.clear();
+            m_storage.reserve(source.size());
+            for (auto const& itr : source)
+                m_storage.emplace_back(itr.first, itr.second);
+            m_storage.shrink_to_fit();
+        }
+
+        void clear() { StorageType().swap(m_storage); }
+
+        const_iterator begin() const { return m_storage.begin(); }
+        const_iterator end() const { return m_storage.end(); }
+        size_type size() const { return m_storage.size(); }
+        bool empty() const { return m_storage.empty(); }
+
+        const_iterator lower_bound(KEY const& key) const
+        {
+            return std::lower_bound(m_storage.begin(), m_storage.end(), key, [](value_type const& elem, KEY const& k) { return elem.first < k; });
+        }
+
+        const_iterator upper_bound(KEY const& key) const
+        {
+            return std::upper_bound(m_storage.begin(), m_storage.end(), key, [](KEY const& k, value_type const& elem) { return k < elem.first; });
+        }
+
+        const_iterator find(KEY const& key) const
+        {
+            const_iterator itr = lower_bound(key);
+            return (itr != m_storage.end() && !(key < itr->first)) ? itr : m_storage.end();
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(KEY const& key) const
+        {
+            const_iterator first = lower_bound(key);
+            const_iterator last = std::upper_bound(first, m_storage.end(), key, [](KEY const& k, value_type const& elem) { return k < elem.first; });
+            return std::make_pair(first, last);
+        }
+
+        size_type count(KEY const& key) const
+        {
+            std::pair<const_iterator, const_iterator> bounds = equal_range(key);
+            return size_type(bounds.second - bounds.first);
+        }
+
+        // direct lookup helper, return nullptr if key is not found
+        VALUE const* Lookup(KEY const& key) const
+        {
+            const_iterator itr = find(key);
+            return itr != m_storage.end() ? &itr->second : nullptr;
+        }
+
+    private:
+        StorageType m_storage;
+};
+
+#endif
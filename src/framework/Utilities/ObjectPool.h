@@ -0,0 +1,348 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OBJECTPOOL_H
+#define MANGOS_OBJECTPOOL_H
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Counted when blocks move between the shared pool and the per thread caches, so blocks kept in
+// thread caches are reported as used
+struct ObjectPoolStats
+{
+    uint64 allocations;                                     // blocks handed out by the shared pool
+    uint64 reused;                                          // of them, blocks that were freed before
+    uint64 unpooled;                                        // allocations of derived types, passed to global allocator
+    uint32 used;                                            // blocks out of the shared pool, in use or cached by threads
+    uint32 free;                                            // blocks ready for reuse in the shared pool
+    uint32 slabs;                                           // slabs currently taken from global allocator
+    uint32 released;                                        // slabs given back to global allocator
+};
+
+/*
+  @class SlabPool
+  Fixed size block allocator: blocks are carved from slabs of slabBlocks blocks and freed blocks
+  are kept for reuse. A slab whose blocks are all free again is given back to the global allocator
+  once the pool holds at least one more slab worth of free blocks, so the heap footprint follows
+  the object count down after a peak without thrashing around a slab boundary.
+  Thread safe, but meant to be used through a PoolThreadCache: the lock is only taken to move
+  batches of blocks between the shared pool and a thread.
+ */
+class SlabPool
+{
+    public:
+        SlabPool(size_t blockSize, size_t slabBlocks)
+            : m_blockSize(AlignedSize(blockSize)), m_slabBlocks(uint32(slabBlocks)), m_freeCount(0), m_unpooled(0), m_stats()
+        {}
+
+        void* Allocate()
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            return AllocateBlock();
+        }
+
+        void Free(void* block)
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            FreeBlock(block);
+        }
+
+        // appends count blocks to blocks
+        void AllocateBatch(std::vector<void*>& blocks, size_t count)
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            for (size_t i = 0; i < count; ++i)
+                blocks.push_back(AllocateBlock());
+        }
+
+        // frees and removes the last count blocks of blocks
+        void FreeBatch(std::vector<void*>& blocks, size_t count)
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            for (size_t i = 0; i < count; ++i)
+            {
+                FreeBlock(blocks.back());
+                blocks.pop_back();
+            }
+        }
+
+        // true if the block was carved from a slab of this pool
+        bool Owns(void* block)
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            return FindSlab(block) != m_slabs.end();
+        }
+
+        void CountUnpooled() { m_unpooled.fetch_add(1, std::memory_order_relaxed); }
+
+        ObjectPoolStats GetStats()
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            ObjectPoolStats stats = m_stats;
+            stats.unpooled = m_unpooled.load(std::memory_order_relaxed);
+            stats.free = m_freeCount;
+            stats.slabs = uint32(m_slabs.size());
+            return stats;
+        }
+
+    private:
+        struct Slab
+        {
+            char* base;
+            void* freeList;                                 // freed blocks, linked through their first bytes
+            uint32 carved;                                  // blocks handed out from base at least once
+            uint32 freeCount;                               // blocks in the free list plus not yet carved ones
+            bool available;                                 // listed in m_available
+        };
+
+        static size_t AlignedSize(size_t size)
+        {
+            size_t const align = alignof(std::max_align_t);
+            size = std::max(size, sizeof(void*));
+            return (size + align - 1) / align * align;
+        }
+
+        std::vector<Slab*>::iterator FindSlab(void* block)
+        {
+            // slabs are sorted by base address
+            auto itr = std::upper_bound(m_slabs.begin(), m_slabs.end(), static_cast<char*>(block),
+                [](char* address, Slab const* slab) { return address < slab->base; });
+            if (itr == m_slabs.begin())
+                return m_slabs.end();
+            --itr;
+            if (static_cast<char*>(block) >= (*itr)->base + m_blockSize * m_slabBlocks)
+                return m_slabs.end();
+            return itr;
+        }
+
+        void* AllocateBlock()
+        {
+            // drop slabs which were emptied since they were listed
+            while (!m_available.empty() && !m_available.back()->freeCount)
+            {
+                m_available.back()->available = false;
+                m_available.pop_back();
+            }
+            if (m_available.empty())
+                AddSlab();
+
+            Slab* slab = m_available.back();
+            void* block;
+            if (slab->freeList)
+            {
+                block = slab->freeList;
+                slab->freeList = *static_cast<void**>(block);
+                ++m_stats.reused;
+            }
+            else
+                block = slab->base + size_t(slab->carved++) * m_blockSize;
+
+            --slab->freeCount;
+            --m_freeCount;
+            ++m_stats.allocations;
+            ++m_stats.used;
+            return block;
+        }
+
+        void FreeBlock(void* block)
+        {
+            auto itr = FindSlab(block);
+            Slab* slab = *itr;
+            *static_cast<void**>(block) = slab->freeList;
+            slab->freeList = block;
+            ++slab->freeCount;
+            ++m_freeCount;
+            --m_stats.used;
+
+            if (slab->freeCount == m_slabBlocks && m_freeCount >= 2 * m_slabBlocks)
+            {
+                ReleaseSlab(itr);
+                return;
+            }
+
+            if (!slab->available)
+            {
+                slab->available = true;
+                m_available.push_back(slab);
+            }
+        }
+
+        void AddSlab()
+        {
+            Slab* slab = new Slab();
+            slab->base = static_cast<char*>(::operator new(m_blockSize * m_slabBlocks));
+            slab->freeList = nullptr;
+            slab->carved = 0;
+            slab->freeCount = m_slabBlocks;
+            slab->available = true;
+            m_slabs.insert(std::upper_bound(m_slabs.begin(), m_slabs.end(), slab->base,
+                [](char* address, Slab const* other) { return address < other->base; }), slab);
+            m_available.push_back(slab);
+            m_freeCount += m_slabBlocks;
+        }
+
+        void ReleaseSlab(std::vector<Slab*>::iterator itr)
+        {
+            Slab* slab = *itr;
+            if (slab->available)
+                m_available.erase(std::find(m_available.begin(), m_available.end(), slab));
+            m_slabs.erase(itr);
+            m_freeCount -= m_slabBlocks;
+            ++m_stats.released;
+            ::operator delete(slab->base);
+            delete slab;
+        }
+
+        size_t const m_blockSize;
+        uint32 const m_slabBlocks;
+        std::mutex m_lock;
+        std::vector<Slab*> m_slabs;                         // sorted by base address
+        std::vector<Slab*> m_available;                     // slabs with free blocks, last one is used first
+        uint32 m_freeCount;
+        std::atomic<uint64> m_unpooled;
+        ObjectPoolStats m_stats;
+};
+
+/*
+  @class PoolThreadCache
+  Free blocks of one SlabPool owned by one thread: allocation and free are lock free while the
+  cache has blocks or room, the shared pool lock is taken once per BATCH_BLOCKS blocks. Blocks
+  freed by another thread than the allocating one simply flow back through the shared pool.
+ */
+class PoolThreadCache
+{
+    public:
+        explicit PoolThreadCache(SlabPool& pool) : m_pool(pool) {}
+        ~PoolThreadCache() { m_pool.FreeBatch(m_blocks, m_blocks.size()); }
+
+        void* Allocate()
+        {
+            if (m_blocks.empty())
+                m_pool.AllocateBatch(m_blocks, BATCH_BLOCKS);
+            void* block = m_blocks.back();
+            m_blocks.pop_back();
+            return block;
+        }
+
+        void Free(void* block)
+        {
+            m_blocks.push_back(block);
+            if (m_blocks.size() >= 2 * BATCH_BLOCKS)
+                m_pool.FreeBatch(m_blocks, BATCH_BLOCKS);
+        }
+
+    private:
+        static size_t const BATCH_BLOCKS = 16;
+
+        SlabPool& m_pool;
+        std::vector<void*> m_blocks;
+};
+
+/*
+  @class PooledObject
+  Base for large world entities created and deleted at every grid load, unload and respawn:
+  memory of T objects comes from a SlabPool of T through a cache of the current thread.
+  Derived classes (different size) use global allocator.
+ */
+template<class T, size_t SLAB_BLOCKS = 64>
+class PooledObject
+{
+    public:
+        static void* operator new(size_t size)
+        {
+            if (size != sizeof(T))
+            {
+                GetPool().CountUnpooled();
+                return ::operator new(size);
+            }
+            if (PoolThreadCache* cache = GetThreadCache())
+                return cache->Allocate();
+            return GetPool().Allocate();
+        }
+
+        static void operator delete(void* ptr, size_t size)
+        {
+            if (size != sizeof(T))
+                ::operator delete(ptr);
+            else if (PoolThreadCache* cache = GetThreadCache())
+                cache->Free(ptr);
+            else
+                GetPool().Free(ptr);
+        }
+
+        // class allocation functions hide the global ones, keep placement and nothrow forms usable
+        static void* operator new(size_t /*size*/, void* where) noexcept { return where; }
+        static void operator delete(void* /*ptr*/, void* /*where*/) noexcept {}
+
+        static void* operator new(size_t size, std::nothrow_t const&) noexcept
+        {
+            try
+            {
+                return operator new(size);
+            }
+            catch (std::bad_alloc const&)
+            {
+                return nullptr;
+            }
+        }
+
+        // only called when a constructor throws after nothrow new, the size is not known there
+        static void operator delete(void* ptr, std::nothrow_t const&) noexcept
+        {
+            if (GetPool().Owns(ptr))
+                GetPool().Free(ptr);
+            else
+                ::operator delete(ptr);
+        }
+
+        static ObjectPoolStats GetPoolStats() { return GetPool().GetStats(); }
+
+    private:
+        static SlabPool& GetPool()
+        {
+            // never destroyed, objects may still be deleted by other singletons at exit
+            static SlabPool* pool = new SlabPool(sizeof(T), SLAB_BLOCKS);
+            return *pool;
+        }
+
+        // null once the thread cache is destroyed at thread exit, later frees go to the shared pool
+        static PoolThreadCache* GetThreadCache()
+        {
+            static thread_local bool destroyed = false;
+            if (destroyed)
+                return nullptr;
+
+            struct Holder
+            {
+                Holder() : cache(GetPool()) {}
+                ~Holder() { destroyed = true; }
+                PoolThreadCache cache;
+            };
+            static thread_local Holder holder;
+            return &holder.cache;
+        }
+};
+
+#endif
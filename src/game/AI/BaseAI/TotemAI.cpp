@@ -47,11 +47,10 @@ void TotemAI::EnterEvadeMode()
 
     // Handle Evade events
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_EVADE, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_EVADE)
-            CheckAndReadyEventForExecution(i);
-    }
+        CheckAndReadyEventForExecution(i);
+    });
     ProcessEvents();
 }
 
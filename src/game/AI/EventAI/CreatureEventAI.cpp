@@ -93,6 +93,7 @@ CreatureEventAI::CreatureEventAI(Creature* creature) : CreatureAI(creature),
     m_InvinceabilityHpLevel(0),
     m_throwAIEventMask(0),
     m_throwAIEventStep(0),
+    m_eventTypeOffsets(),
     m_LastSpellMaxRange(0),
     m_despawnAggregationMask(0)
 {
@@ -148,20 +149,50 @@ void CreatureEventAI::InitAI()
         }
     };
 
-    // Need make copy for filter unneeded steps and safe in case table reload
-    auto creatureEventsItr = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap()->find(m_creature->GetEntry());
-    if (creatureEventsItr != m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap()->end())
+    // Holders only reference the definitions, keep the containers alive in case of table reload
+    m_eventEntryMap = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventEntryAIMap();
+    m_eventGuidMap = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap();
+
+    auto creatureEventsItr = m_eventEntryMap->find(m_creature->GetEntry());
+    if (creatureEventsItr != m_eventEntryMap->end())
     {
         const CreatureEventAI_Event_Vec& creatureEvent = creatureEventsItr->second;
         processMap(creatureEvent);
     }
 
-    auto creatureEventsGuidItr = m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap()->find(m_creature->GetDbGuid());
-    if (creatureEventsGuidItr != m_creature->GetMap()->GetMapDataContainer().GetCreatureEventGuidAIMap()->end())
+    auto creatureEventsGuidItr = m_eventGuidMap->find(m_creature->GetDbGuid());
+    if (creatureEventsGuidItr != m_eventGuidMap->end())
     {
         const CreatureEventAI_Event_Vec& creatureEvent = creatureEventsGuidItr->second;
         processMap(creatureEvent);
     }
+
+    BuildEventIndex();
+}
+
+void CreatureEventAI::BuildEventIndex()
+{
+    // counting sort by type, events of a type keep their list order
+    std::fill(std::begin(m_eventTypeOffsets), std::end(m_eventTypeOffsets), 0);
+    for (CreatureEventAIHolder const& holder : m_CreatureEventAIList)
+        ++m_eventTypeOffsets[holder.event.event_type + 1];
+    for (uint32 type = 0; type < EVENT_T_END; ++type)
+        m_eventTypeOffsets[type + 1] += m_eventTypeOffsets[type];
+
+    uint16 next[EVENT_T_END];
+    std::copy(m_eventTypeOffsets, m_eventTypeOffsets + EVENT_T_END, next);
+
+    m_eventsByType.resize(m_CreatureEventAIList.size());
+    m_timedEvents.clear();
+    for (uint32 i = 0; i < m_CreatureEventAIList.size(); ++i)
+    {
+        EventAI_Type type = m_CreatureEventAIList[i].event.event_type;
+        m_eventsByType[next[type]++] = uint16(i);
+
+        // only these events get timers or are checked on update
+        if (IsTimerBasedEvent(type) || type == EVENT_T_TARGET_NOT_REACHABLE)
+            m_timedEvents.push_back(uint16(i));
+    }
 }
 
 bool CreatureEventAI::IsTimerExecutedEvent(EventAI_Type type) const
@@ -838,7 +869,8 @@ bool CreatureEventAI::ProcessAction(CreatureEventAI_Action const& action, uint32
             break;
         case ACTION_T_THREAT_ALL_PCT:
         {
-            ThreatList const& threatList = m_creature->getThreatManager().getThreatList();
+            // copy - modifyThreatPercent below -101 removes the reference from the list
+            ThreatList const threatList = m_creature->getThreatManager().getThreatList();
             for (auto i : threatList)
                 if (Unit* Temp = m_creature->GetMap()->GetUnit(i->getUnitGuid()))
                     m_creature->getThreatManager().modifyThreatPercent(Temp, action.threat_all_pct.percent);
@@ -1457,11 +1489,10 @@ void CreatureEventAI::Reset()
 void CreatureEventAI::JustReachedHome()
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_REACHED_HOME, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_REACHED_HOME)
-            CheckAndReadyEventForExecution(i);
-    }
+        CheckAndReadyEventForExecution(i);
+    });
     ProcessEvents();
 
     Reset();
@@ -1473,11 +1504,10 @@ void CreatureEventAI::EnterEvadeMode()
 
     // Handle Evade events
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_EVADE, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_EVADE)
-            CheckAndReadyEventForExecution(i);
-    }
+        CheckAndReadyEventForExecution(i);
+    });
     ProcessEvents();
 
     if ((m_despawnAggregationMask & AGGREGATION_EVADE) != 0)
@@ -1494,11 +1524,10 @@ void CreatureEventAI::JustDied(Unit* killer)
 
     // Handle On Death events
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_DEATH, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_DEATH)
-            CheckAndReadyEventForExecution(i, killer);
-    }
+        CheckAndReadyEventForExecution(i, killer);
+    });
     ProcessEvents(killer);
 
     // reset phase after any death state events
@@ -1511,22 +1540,20 @@ void CreatureEventAI::JustDied(Unit* killer)
 void CreatureEventAI::KilledUnit(Unit* victim)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_KILL, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_KILL)
-            CheckAndReadyEventForExecution(i, victim);
-    }
+        CheckAndReadyEventForExecution(i, victim);
+    });
     ProcessEvents(victim);
 }
 
 void CreatureEventAI::JustSummoned(Creature* summoned)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_SUMMONED_UNIT, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_UNIT)
-            CheckAndReadyEventForExecution(i, summoned);
-    }
+        CheckAndReadyEventForExecution(i, summoned);
+    });
     ProcessEvents(summoned);
     if ((m_despawnAggregationMask & AGGREGATION_ENABLED) != 0)
         if (m_entriesForDespawn.empty() || m_entriesForDespawn.find(summoned->GetEntry()) != m_entriesForDespawn.end())
@@ -1536,22 +1563,20 @@ void CreatureEventAI::JustSummoned(Creature* summoned)
 void CreatureEventAI::SummonedCreatureJustDied(Creature* summoned)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_SUMMONED_JUST_DIED, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_JUST_DIED)
-            CheckAndReadyEventForExecution(i, summoned);
-    }
+        CheckAndReadyEventForExecution(i, summoned);
+    });
     ProcessEvents(summoned);
 }
 
 void CreatureEventAI::SummonedCreatureDespawn(Creature* summoned)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_SUMMONED_JUST_DESPAWN, [&](CreatureEventAIHolder& i)
     {
-        if (i.event.event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
-            CheckAndReadyEventForExecution(i, summoned);
-    }
+        CheckAndReadyEventForExecution(i, summoned);
+    });
     ProcessEvents(summoned);
 }
 
@@ -1560,12 +1585,11 @@ void CreatureEventAI::ReceiveAIEvent(AIEventType eventType, Unit* sender, Unit*
     MANGOS_ASSERT(sender);
 
     IncreaseDepthIfNecessary();
-    for (auto& itr : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_RECEIVE_AI_EVENT, [&](CreatureEventAIHolder& itr)
     {
-        if (itr.event.event_type == EVENT_T_RECEIVE_AI_EVENT &&
-                itr.event.receiveAIEvent.eventType == uint32(eventType) && (!itr.event.receiveAIEvent.senderEntry || itr.event.receiveAIEvent.senderEntry == sender->GetEntry()))
+        if (itr.event.receiveAIEvent.eventType == uint32(eventType) && (!itr.event.receiveAIEvent.senderEntry || itr.event.receiveAIEvent.senderEntry == sender->GetEntry()))
             CheckAndReadyEventForExecution(itr, invoker, sender);
-    }
+    });
     ProcessEvents(invoker, sender);
 }
 
@@ -1580,11 +1604,12 @@ void CreatureEventAI::CorpseRemoved(uint32& respawnDelay)
 void CreatureEventAI::OnSpellCast(SpellEntry const* spellInfo, Unit* target)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELL_CAST)
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (spellInfo->Id == i.event.spellCast.spellId)
-                CheckAndReadyEventForExecution(i, target);
+    ForEachEventOfType(EVENT_T_SPELL_CAST, [&](CreatureEventAIHolder& i)
+    {
+        // If spell id matches
+        if (spellInfo->Id == i.event.spellCast.spellId)
+            CheckAndReadyEventForExecution(i, target);
+    });
 
     ProcessEvents(target);
 }
@@ -1594,31 +1619,25 @@ void CreatureEventAI::EnterCombat(Unit* enemy)
     CreatureAI::EnterCombat(enemy);
     // Check for on combat start events
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_AGGRO, [&](CreatureEventAIHolder& i)
     {
-        CreatureEventAI_Event const& event = i.event;
-        switch (event.event_type)
+        i.enabled = true;
+        CheckAndReadyEventForExecution(i, enemy);
+    });
+    // Reset all in combat timers
+    ForEachEventOfType(EVENT_T_TIMER_IN_COMBAT, [&](CreatureEventAIHolder& i)
+    {
+        if (i.UpdateRepeatTimer(m_creature, i.event.timer.initialMin, i.event.timer.initialMax))
+            i.enabled = true;
+    });
+    // Reset some special combat timers using repeatMin/Max
+    for (EventAI_Type type : { EVENT_T_FRIENDLY_HP, EVENT_T_FRIENDLY_IS_CC, EVENT_T_FRIENDLY_MISSING_BUFF, EVENT_T_SELECT_ATTACKING_TARGET })
+    {
+        ForEachEventOfType(type, [&](CreatureEventAIHolder& i)
         {
-            case EVENT_T_AGGRO:
+            if (i.UpdateRepeatTimer(m_creature, i.event.timer.repeatMin, i.event.timer.repeatMax))
                 i.enabled = true;
-                CheckAndReadyEventForExecution(i, enemy);
-                break;
-            // Reset all in combat timers
-            case EVENT_T_TIMER_IN_COMBAT:
-                if (i.UpdateRepeatTimer(m_creature, event.timer.initialMin, event.timer.initialMax))
-                    i.enabled = true;
-                break;
-            // Reset some special combat timers using repeatMin/Max
-            case EVENT_T_FRIENDLY_HP:
-            case EVENT_T_FRIENDLY_IS_CC:
-            case EVENT_T_FRIENDLY_MISSING_BUFF:
-            case EVENT_T_SELECT_ATTACKING_TARGET:
-                if (i.UpdateRepeatTimer(m_creature, event.timer.repeatMin, event.timer.repeatMax))
-                    i.enabled = true;
-                break;
-            default:
-                break;
-        }
+        });
     }
     ProcessEvents(enemy);
 
@@ -1632,27 +1651,24 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
     IncreaseDepthIfNecessary();
     if (m_HasOOCLoSEvent && !m_creature->GetVictim())
     {
-        for (auto& itr : m_CreatureEventAIList)
+        ForEachEventOfType(EVENT_T_OOC_LOS, [&](CreatureEventAIHolder& itr)
         {
-            if (itr.event.event_type == EVENT_T_OOC_LOS)
-            {
-                // can trigger if closer than fMaxAllowedRange
-                float fMaxAllowedRange = (float)itr.event.ooc_los.maxRange;
+            // can trigger if closer than fMaxAllowedRange
+            float fMaxAllowedRange = (float)itr.event.ooc_los.maxRange;
 
-                // who must be player type if this option is turned on
-                if (!itr.event.ooc_los.playerOnly || who->GetTypeId() == TYPEID_PLAYER)
+            // who must be player type if this option is turned on
+            if (!itr.event.ooc_los.playerOnly || who->GetTypeId() == TYPEID_PLAYER)
+            {
+                // if friendly event && who is not hostile OR hostile event && who is hostile
+                if ((itr.event.ooc_los.noHostile && !m_creature->IsEnemy(who)) ||
+                        ((!itr.event.ooc_los.noHostile) && m_creature->IsEnemy(who)))
                 {
-                    // if friendly event && who is not hostile OR hostile event && who is hostile
-                    if ((itr.event.ooc_los.noHostile && !m_creature->IsEnemy(who)) ||
-                            ((!itr.event.ooc_los.noHostile) && m_creature->IsEnemy(who)))
-                    {
-                        // if range is ok and we are actually in LOS
-                        if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
-                            CheckAndReadyEventForExecution(itr, who);
-                    }
+                    // if range is ok and we are actually in LOS
+                    if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
+                        CheckAndReadyEventForExecution(itr, who);
                 }
             }
-        }
+        });
         ProcessEvents(who);
     }
 
@@ -1662,12 +1678,13 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
 void CreatureEventAI::SpellHit(Unit* unit, const SpellEntry* spellInfo)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELLHIT)
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i.event.spell_hit.spellId || spellInfo->Id == i.event.spell_hit.spellId)
-                if (GetSchoolMask(spellInfo->School) & i.event.spell_hit.schoolMask)
-                    CheckAndReadyEventForExecution(i, unit);
+    ForEachEventOfType(EVENT_T_SPELLHIT, [&](CreatureEventAIHolder& i)
+    {
+        // If spell id matches (or no spell id) & if spell school matches (or no spell school)
+        if (!i.event.spell_hit.spellId || spellInfo->Id == i.event.spell_hit.spellId)
+            if (GetSchoolMask(spellInfo->School) & i.event.spell_hit.schoolMask)
+                CheckAndReadyEventForExecution(i, unit);
+    });
 
     ProcessEvents(unit);
 }
@@ -1675,12 +1692,13 @@ void CreatureEventAI::SpellHit(Unit* unit, const SpellEntry* spellInfo)
 void CreatureEventAI::SpellHitTarget(Unit* target, const SpellEntry* spellInfo)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_SPELLHIT_TARGET)
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i.event.spell_hit_target.spellId || spellInfo->Id == i.event.spell_hit_target.spellId)
-                if (GetSchoolMask(spellInfo->School) & i.event.spell_hit_target.schoolMask)
-                    CheckAndReadyEventForExecution(i, target);
+    ForEachEventOfType(EVENT_T_SPELLHIT_TARGET, [&](CreatureEventAIHolder& i)
+    {
+        // If spell id matches (or no spell id) & if spell school matches (or no spell school)
+        if (!i.event.spell_hit_target.spellId || spellInfo->Id == i.event.spell_hit_target.spellId)
+            if (GetSchoolMask(spellInfo->School) & i.event.spell_hit_target.schoolMask)
+                CheckAndReadyEventForExecution(i, target);
+    });
 
     ProcessEvents(target);
 }
@@ -1823,16 +1841,11 @@ inline Unit* CreatureEventAI::GetTargetByType(uint32 target, Unit* actionInvoker
 void CreatureEventAI::ReceiveEmote(Player* player, uint32 textEmote)
 {
     IncreaseDepthIfNecessary();
-    for (auto& itr : m_CreatureEventAIList)
+    ForEachEventOfType(EVENT_T_RECEIVE_EMOTE, [&](CreatureEventAIHolder& itr)
     {
-        if (itr.event.event_type == EVENT_T_RECEIVE_EMOTE)
-        {
-            if (itr.event.receive_emote.emoteId != textEmote)
-                continue;
-
+        if (itr.event.receive_emote.emoteId == textEmote)
             CheckAndReadyEventForExecution(itr, player);
-        }
-    }
+    });
     ProcessEvents(player);
 }
 
@@ -1873,10 +1886,10 @@ void CreatureEventAI::DamageTaken(Unit* dealer, uint32& damage, DamageEffectType
 void CreatureEventAI::JustPreventedDeath(Unit* attacker)
 {
     IncreaseDepthIfNecessary();
-    for (auto& i : m_CreatureEventAIList)
-        if (i.event.event_type == EVENT_T_DEATH_PREVENTED)
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            CheckAndReadyEventForExecution(i, attacker);
+    ForEachEventOfType(EVENT_T_DEATH_PREVENTED, [&](CreatureEventAIHolder& i)
+    {
+        CheckAndReadyEventForExecution(i, attacker);
+    });
 
     ProcessEvents(attacker);
 }
@@ -1930,33 +1943,34 @@ void CreatureEventAI::UpdateEventTimers(const uint32 diff)
 
         // Check for time based events
         IncreaseDepthIfNecessary();
-        for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        for (uint16 index : m_timedEvents)
         {
-            if (i->event.event_type == EVENT_T_TARGET_NOT_REACHABLE)
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[index];
+            if (holder.event.event_type == EVENT_T_TARGET_NOT_REACHABLE)
             {
-                CheckAndReadyEventForExecution(*i);
+                CheckAndReadyEventForExecution(holder);
                 continue;
             }
 
             // Decrement Timers
-            if (i->timer)
+            if (holder.timer)
             {
                 // Do not decrement timers if event cannot trigger in this phase
-                if (!(i->event.event_inverse_phase_mask & (1 << m_Phase)))
+                if (!(holder.event.event_inverse_phase_mask & (1 << m_Phase)))
                 {
-                    if (i->timer > m_EventDiff)
-                        i->timer -= m_EventDiff;
+                    if (holder.timer > m_EventDiff)
+                        holder.timer -= m_EventDiff;
                     else
-                        i->timer = 0;
+                        holder.timer = 0;
                 }
             }
 
             // Skip processing of events that have time remaining or are disabled
-            if (!(i->enabled) || i->timer)
+            if (!holder.enabled || holder.timer)
                 continue;
 
-            if (IsTimerExecutedEvent(i->event.event_type))
-                CheckAndReadyEventForExecution(*i);
+            if (IsTimerExecutedEvent(holder.event.event_type))
+                CheckAndReadyEventForExecution(holder);
         }
         ProcessEvents();
 
@@ -836,11 +836,12 @@ struct CreatureEventAI_Summon
 // EventSummon_Map
 typedef std::unordered_map<uint32, CreatureEventAI_Summon> CreatureEventAI_Summon_Map;
 
+// Per creature state of an event, definition itself is shared between all creatures using it
 struct CreatureEventAIHolder
 {
-    CreatureEventAIHolder(CreatureEventAI_Event p) : event(p), timer(0), enabled(true), inProgress(false), eventTarget(nullptr) {}
+    CreatureEventAIHolder(CreatureEventAI_Event const& p) : event(p), timer(0), enabled(true), inProgress(false), eventTarget(nullptr) {}
 
-    CreatureEventAI_Event event;
+    CreatureEventAI_Event const& event;                     // points into CreatureEventAIMgr containers, kept alive by CreatureEventAI
     uint32 timer;
     bool enabled;
     bool inProgress;
@@ -911,6 +912,16 @@ class CreatureEventAI : public CreatureAI
         bool IsRepeatableEvent(EventAI_Type type) const;
         bool IsTimerBasedEvent(EventAI_Type type) const;
 
+        void BuildEventIndex();
+
+        // calls f(holder) for events of type, in event list order
+        template<class F>
+        void ForEachEventOfType(EventAI_Type type, F&& f)
+        {
+            for (uint32 i = m_eventTypeOffsets[type]; i < m_eventTypeOffsets[type + 1]; ++i)
+                f(m_CreatureEventAIList[m_eventsByType[i]]);
+        }
+
         uint32 m_EventUpdateTime;                           // Time between event updates
         uint32 m_EventDiff;                                 // Time between the last event call
         bool   m_bEmptyList;
@@ -918,6 +929,11 @@ class CreatureEventAI : public CreatureAI
         // Variables used by Events themselves
         typedef std::vector<CreatureEventAIHolder> CreatureEventAIList;
         CreatureEventAIList m_CreatureEventAIList;          // Holder for events (stores enabled, time, and eventid)
+        std::shared_ptr<CreatureEventAI_Event_Map> m_eventEntryMap; // event definitions referenced by m_CreatureEventAIList, kept alive over table reload
+        std::shared_ptr<CreatureEventAI_Event_Map> m_eventGuidMap;
+        std::vector<uint16> m_eventsByType;                 // m_CreatureEventAIList indexes grouped by event type, in list order
+        uint16 m_eventTypeOffsets[EVENT_T_END + 1];         // start of each event type in m_eventsByType
+        std::vector<uint16> m_timedEvents;                  // m_CreatureEventAIList indexes of events handled by UpdateEventTimers
         std::vector<std::vector<std::reference_wrapper<CreatureEventAIHolder>>> m_creatureEventAITempList; // Holder for events that are ready to go off
         uint32 m_depth;
 
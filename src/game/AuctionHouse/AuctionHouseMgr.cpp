@@ -540,6 +540,7 @@ void AuctionHouseObject::Update()
 
             itr->second->DeleteFromDB();
             sAuctionMgr.RemoveAItem(itr->second->itemGuidLow);
+            RemoveFromTemplateIndex(itr->second);
             delete itr->second;
             AuctionsMap.erase(itr++);
         }
@@ -582,6 +583,84 @@ void AuctionHouseObject::BuildListOwnerItems(WorldPacket& data, Player* player,
     }
 }
 
+void AuctionHouseObject::AddAuction(AuctionEntry* ah)
+{
+    MANGOS_ASSERT(ah);
+
+    std::pair<AuctionEntryMap::iterator, bool> res = AuctionsMap.insert(AuctionEntryMap::value_type(ah->Id, ah));
+    if (!res.second)
+    {
+        RemoveFromTemplateIndex(res.first->second);
+        res.first->second = ah;
+    }
+
+    AddToTemplateIndex(ah);
+}
+
+bool AuctionHouseObject::RemoveAuction(uint32 id)
+{
+    AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+    if (itr == AuctionsMap.end())
+        return false;
+
+    RemoveFromTemplateIndex(itr->second);
+    AuctionsMap.erase(itr);
+    return true;
+}
+
+void AuctionHouseObject::AddToTemplateIndex(AuctionEntry* ah)
+{
+    ItemPrototype const* proto = sItemStorage.LookupEntry<ItemPrototype>(ah->itemTemplate);
+    if (!proto)
+        return;
+
+    TemplateAuctions& templateAuctions = m_templateIndex[MakeTemplateIndexKey(proto->Class, proto->SubClass, proto->ItemId)];
+    templateAuctions.proto = proto;
+
+    // new auctions get increasing ids, so this is almost always an append
+    std::vector<AuctionEntry*>& auctions = templateAuctions.auctions;
+    auto itr = std::upper_bound(auctions.begin(), auctions.end(), ah->Id, [](uint32 id, AuctionEntry const* entry) { return id < entry->Id; });
+    auctions.insert(itr, ah);
+}
+
+void AuctionHouseObject::RemoveFromTemplateIndex(AuctionEntry* ah)
+{
+    ItemPrototype const* proto = sItemStorage.LookupEntry<ItemPrototype>(ah->itemTemplate);
+    if (!proto)
+        return;
+
+    TemplateIndexMap::iterator indexItr = m_templateIndex.find(MakeTemplateIndexKey(proto->Class, proto->SubClass, proto->ItemId));
+    if (indexItr == m_templateIndex.end())
+        return;
+
+    std::vector<AuctionEntry*>& auctions = indexItr->second.auctions;
+    auto itr = std::find(auctions.begin(), auctions.end(), ah);
+    if (itr != auctions.end())
+        auctions.erase(itr);
+
+    if (auctions.empty())
+        m_templateIndex.erase(indexItr);
+}
+
+std::wstring const& AuctionHouseObject::TemplateAuctions::GetLowerName(int loc_idx)
+{
+    auto itr = lowerNames.find(loc_idx);
+    if (itr != lowerNames.end())
+        return itr->second;
+
+    std::string name = proto->Name1;
+    sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
+
+    // an empty name never matches a search, same as a failed conversion in Utf8FitTo
+    std::wstring& wname = lowerNames[loc_idx];
+    if (Utf8toWStr(name, wname))
+        wstrToLower(wname);
+    else
+        wname.clear();
+
+    return wname;
+}
+
 void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
         std::wstring const& wsearchedname, uint32 listfrom, uint32 levelmin, uint32 levelmax, uint32 usable,
         uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
@@ -589,65 +668,83 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
 {
     int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
 
-    for (auto& AentryItr : AuctionsMap)
-    {
-        auto Aentry = AentryItr.second;
-        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
-        if (!item)
-            continue;
+    // no item template has class/subclass values outside of the index key fields
+    if ((itemClass != 0xffffffff && itemClass >= 0xffff) || (itemSubClass != 0xffffffff && itemSubClass >= 0xffff))
+        return;
 
+    // select the part of the template index allowed by class/subclass filters
+    TemplateIndexMap::iterator indexItr = m_templateIndex.begin();
+    TemplateIndexMap::iterator indexEnd = m_templateIndex.end();
+    if (itemClass != 0xffffffff)
+    {
+        if (itemSubClass != 0xffffffff)
         {
-            ItemPrototype const* proto = item->GetProto();
+            indexItr = m_templateIndex.lower_bound(MakeTemplateIndexKey(itemClass, itemSubClass, 0));
+            indexEnd = m_templateIndex.lower_bound(MakeTemplateIndexKey(itemClass, itemSubClass + 1, 0));
+        }
+        else
+        {
+            indexItr = m_templateIndex.lower_bound(MakeTemplateIndexKey(itemClass, 0, 0));
+            indexEnd = m_templateIndex.lower_bound(MakeTemplateIndexKey(itemClass + 1, 0, 0));
+        }
+    }
 
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-                continue;
+    std::vector<AuctionEntry*> matches;
+    for (; indexItr != indexEnd; ++indexItr)
+    {
+        ItemPrototype const* proto = indexItr->second.proto;
 
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-                continue;
+        if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
+            continue;
 
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
+        if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
+        {
+            if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
             {
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                {
-                    // if inventory type is chest, we want to return robes too
-                    // i.e. cloth chests are in most cases robes by definition
+                // if inventory type is chest, we want to return robes too
+                // i.e. cloth chests are in most cases robes by definition
 
-                    continue;
-                }
+                continue;
             }
+        }
 
-            if (quality != 0xffffffff && proto->Quality < quality)
-                continue;
+        if (quality != 0xffffffff && proto->Quality < quality)
+            continue;
 
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-                continue;
+        if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
+            continue;
 
-            if (usable != 0x00)
+        if (usable != 0x00 && proto->Class == ITEM_CLASS_RECIPE)
+        {
+            if (SpellEntry const* spell = sSpellTemplate.LookupEntry<SpellEntry>(proto->Spells[0].SpellId))
             {
-                if (player->CanUseItem(item) != EQUIP_ERR_OK)
+                if (player->HasSpell(spell->EffectTriggerSpell[EFFECT_INDEX_0]))
                     continue;
-
-                if (proto->Class == ITEM_CLASS_RECIPE)
-                {
-                    if (SpellEntry const* spell = sSpellTemplate.LookupEntry<SpellEntry>(proto->Spells[0].SpellId))
-                    {
-                        if (player->HasSpell(spell->EffectTriggerSpell[EFFECT_INDEX_0]))
-                            continue;
-                    }
-                }
             }
+        }
 
-            std::string name = proto->Name1;
-            sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
+        if (!wsearchedname.empty() && indexItr->second.GetLowerName(loc_idx).find(wsearchedname) == std::wstring::npos)
+            continue;
 
-            if (!wsearchedname.empty() && !Utf8FitTo(name, wsearchedname))
-                continue;
+        matches.insert(matches.end(), indexItr->second.auctions.begin(), indexItr->second.auctions.end());
+    }
 
-            if (count < MAX_AUCTION_ITEMS_CLIENT_UI_PAGE && totalcount >= listfrom)
-            {
-                ++count;
-                Aentry->BuildAuctionInfo(data);
-            }
+    // keep auction id order of the list, so pages stay stable
+    std::sort(matches.begin(), matches.end(), [](AuctionEntry const* a, AuctionEntry const* b) { return a->Id < b->Id; });
+
+    for (AuctionEntry* Aentry : matches)
+    {
+        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
+        if (!item)
+            continue;
+
+        if (usable != 0x00 && player->CanUseItem(item) != EQUIP_ERR_OK)
+            continue;
+
+        if (count < MAX_AUCTION_ITEMS_CLIENT_UI_PAGE && totalcount >= listfrom)
+        {
+            ++count;
+            Aentry->BuildAuctionInfo(data);
         }
 
         ++totalcount;
@@ -26,6 +26,7 @@ class Item;
 class Player;
 class Unit;
 class WorldPacket;
+struct ItemPrototype;
 
 #define MIN_AUCTION_TIME (2*HOUR)
 
@@ -98,11 +99,7 @@ class AuctionHouseObject
         AuctionEntryMap const& GetAuctions() const { return AuctionsMap; }
         AuctionEntryMapBounds GetAuctionsBounds() const {return AuctionEntryMapBounds(AuctionsMap.begin(), AuctionsMap.end()); }
 
-        void AddAuction(AuctionEntry* ah)
-        {
-            MANGOS_ASSERT(ah);
-            AuctionsMap[ah->Id] = ah;
-        }
+        void AddAuction(AuctionEntry* ah);
 
         AuctionEntry* GetAuction(uint32 id) const
         {
@@ -110,7 +107,7 @@ class AuctionHouseObject
             return itr != AuctionsMap.end() ? itr->second : nullptr;
         }
 
-        bool RemoveAuction(uint32 id) { return !!AuctionsMap.erase(id); }
+        bool RemoveAuction(uint32 id);
 
         void Update();
 
@@ -122,7 +119,29 @@ class AuctionHouseObject
                                    uint32& count, uint32& totalcount);
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout = 0, uint32 deposit = 0, Player* pl = nullptr);
     private:
+        // browse index: auctions grouped by item template, all template level filters are checked once per template
+        struct TemplateAuctions
+        {
+            ItemPrototype const* proto;
+            std::vector<AuctionEntry*> auctions;            // sorted by auction id
+            std::unordered_map<int, std::wstring> lowerNames; // lowercased (localized) item name cache, by db locale index
+
+            std::wstring const& GetLowerName(int loc_idx);
+        };
+
+        // key: item class << 48 | item subclass << 32 | item template, so class and subclass filters select a contiguous range
+        typedef std::map<uint64, TemplateAuctions> TemplateIndexMap;
+
+        static uint64 MakeTemplateIndexKey(uint32 itemClass, uint32 itemSubClass, uint32 itemTemplate)
+        {
+            return (uint64(itemClass) << 48) | (uint64(itemSubClass) << 32) | itemTemplate;
+        }
+
+        void AddToTemplateIndex(AuctionEntry* ah);
+        void RemoveFromTemplateIndex(AuctionEntry* ah);
+
         AuctionEntryMap AuctionsMap;
+        TemplateIndexMap m_templateIndex;
 };
 
 enum AuctionHouseType
@@ -58,6 +58,7 @@
 #include "Metric/Metric.h"
 #endif
 #include "Server/PacketLog.h"
+#include "Server/OpcodeStats.h"
 
 #include "Globals/UnitCondition.h"
 #include "Globals/CombatCondition.h"
@@ -4417,6 +4418,7 @@ static bool HandleResetStatsOrLevelHelper(Player* player)
 
     player->SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, DEFAULT_WORLD_OBJECT_SIZE);
     player->SetFloatValue(UNIT_FIELD_COMBATREACH, 1.5f);
+    player->UpdatePositionIndex();
 
     player->setFactionForRace(player->getRace());
 
@@ -5811,6 +5813,37 @@ bool ChatHandler::HandleServerPLimitCommand(char* args)
     return true;
 }
 
+bool ChatHandler::HandleServerOpcodeStatsCommand(char* args)
+{
+    if (ExtractLiteralArg(&args, "reset"))
+    {
+        sOpcodeStats.Reset();
+        SendSysMessage("Opcode statistics reset.");
+        return true;
+    }
+
+    uint32 count;
+    if (!ExtractOptUInt32(&args, count, 10))
+        return false;
+
+    std::vector<OpcodeStatsEntry> entries = sOpcodeStats.GetEntries();
+    if (entries.size() > count)
+        entries.resize(count);
+
+    SendSysMessage("Opcode: handled (total/avg/p95/max us), wait (avg/p95 us), in (packets/bytes), out (packets/bytes), over budget");
+    for (OpcodeStatsEntry const& entry : entries)
+    {
+        PSendSysMessage("%s: " UI64FMTD " (" UI64FMTD "/" UI64FMTD "/%u/%u), wait (" UI64FMTD "/%u), in (" UI64FMTD "/" UI64FMTD "), out (" UI64FMTD "/" UI64FMTD "), " UI64FMTD,
+            LookupOpcodeName(entry.opcode), entry.executed,
+            entry.handlerTotal, entry.executed ? entry.handlerTotal / entry.executed : 0,
+            OpcodeStatsEntry::Percentile(entry.handlerBuckets, 95), entry.handlerMax,
+            entry.executed ? entry.waitTotal / entry.executed : 0, OpcodeStatsEntry::Percentile(entry.waitBuckets, 95),
+            entry.received, entry.bytesIn, entry.sent, entry.bytesOut, entry.overBudget);
+    }
+
+    return true;
+}
+
 bool ChatHandler::HandleCastCommand(char* args)
 {
     if (!*args)
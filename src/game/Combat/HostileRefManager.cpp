@@ -57,11 +57,15 @@ void HostileRefManager::threatAssist(Unit* victim, float threat, SpellEntry cons
         ref = ref->next();
     }
 
+    if (validRefs.empty())
+        return;
+
     uint32 size = singleTarget ? 1 : validRefs.size();            // if singleTarget do not devide threat
-    float threatPerTarget = threat / size;
+    // victim side modifiers are the same for every hater, calculate them once for the whole batch
+    float threatPerTarget = ThreatCalcHelper::CalcHatedUnitThreat(victim, threat / size, false, (threatSpell ? GetSpellSchoolMask(threatSpell) : SPELL_SCHOOL_MASK_NORMAL), threatSpell);
     for (HostileReference* validReference : validRefs)
     {
-        validReference->getSource()->addThreat(victim, threatPerTarget, false, (threatSpell ? GetSpellSchoolMask(threatSpell) : SPELL_SCHOOL_MASK_NORMAL), threatSpell);
+        validReference->getSource()->addCalculatedThreat(victim, threatPerTarget, threatSpell);
         if (!ignoreTimer)
             victim->GetCombatManager().TriggerCombatTimer(validReference->getSource()->getOwner());
     }
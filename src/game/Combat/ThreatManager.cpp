@@ -32,6 +32,14 @@
 
 // The pHatingUnit is not used yet
 float ThreatCalcHelper::CalcThreat(Unit* hatedUnit, Unit* hatingUnit, float threat, bool crit, SpellSchoolMask schoolMask, SpellEntry const* threatSpell)
+{
+    if (hatingUnit->GetTypeId() == TYPEID_PLAYER) // players have entries with 0 threat during charm
+        return 0.f;
+
+    return CalcHatedUnitThreat(hatedUnit, threat, crit, schoolMask, threatSpell);
+}
+
+float ThreatCalcHelper::CalcHatedUnitThreat(Unit* hatedUnit, float threat, bool crit, SpellSchoolMask schoolMask, SpellEntry const* threatSpell)
 {
     // all flat mods applied early
     if (!threat)
@@ -40,9 +48,6 @@ float ThreatCalcHelper::CalcThreat(Unit* hatedUnit, Unit* hatingUnit, float thre
     if (hatedUnit->GetNoThreatState()) // some NPCs cause no threat
         return 0.f;
 
-    if (hatingUnit->GetTypeId() == TYPEID_PLAYER) // players have entries with 0 threat during charm
-        return 0.f;
-
     if (threatSpell)
     {
         if (Player* modOwner = hatedUnit->GetSpellModOwner())
@@ -207,6 +212,35 @@ Unit* HostileReference::getSourceUnit() const
 //================ ThreatContainer ===========================
 //============================================================
 
+void ThreatContainer::remove(HostileReference* ref)
+{
+    ThreatList::iterator itr = std::find(iThreatList.begin(), iThreatList.end(), ref);
+    if (itr != iThreatList.end())
+        iThreatList.erase(itr);
+
+    itr = std::find(iChangedRefs.begin(), iChangedRefs.end(), ref);
+    if (itr != iChangedRefs.end())
+        iChangedRefs.erase(itr);
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileReference)
+{
+    iThreatList.push_back(hostileReference);
+    setChanged(hostileReference);
+}
+
+//============================================================
+
+void ThreatContainer::setChanged(HostileReference* hostileReference)
+{
+    if (std::find(iChangedRefs.begin(), iChangedRefs.end(), hostileReference) == iChangedRefs.end())
+        iChangedRefs.push_back(hostileReference);
+}
+
+//============================================================
+
 void ThreatContainer::clearReferences()
 {
     for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
@@ -215,6 +249,7 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iChangedRefs.clear();
 }
 
 //============================================================
@@ -287,40 +322,72 @@ void ThreatContainer::modifyAllThreatPercent(int32 threatPercent)
 
 void ThreatContainer::update(bool force, bool isPlayer)
 {
-    if ((iDirty || force || isPlayer) && iThreatList.size() > 1)
+    if (iThreatList.size() <= 1 || (!iDirty && !force && !isPlayer && iChangedRefs.empty()))
     {
-        iThreatList.sort([&](const HostileReference* lhs, const HostileReference* rhs)->bool
+        iChangedRefs.clear();
+        iDirty = false;
+        return;
+    }
+
+    auto comparator = [&](const HostileReference* lhs, const HostileReference* rhs)->bool
+    {
+        Unit* owner = lhs->getSource()->getOwner();
+        if (isPlayer)
         {
-            Unit* owner = lhs->getSource()->getOwner();
-            if (isPlayer)
-            {
-                Unit* left = lhs->getTarget();
-                Unit* right = rhs->getTarget();
-                if (left->IsPlayer() && !right->IsPlayer())
-                    return true;
-                if (!left->IsPlayer() && right->IsPlayer())
-                    return false;
-                bool attackLeft = owner->CanAttack(left);
-                bool attackRight = owner->CanAttack(right);
-                if (attackLeft && !attackRight)
-                    return true;
-                if (!attackLeft && attackRight)
-                    return false;
-            }
-            if (lhs->GetTauntState() != rhs->GetTauntState())
-                return lhs->GetTauntState() > rhs->GetTauntState();
-            if (force)
-            {
-                bool first = owner->CanReachWithMeleeAttack(lhs->getTarget());
-                bool second = owner->CanReachWithMeleeAttack(rhs->getTarget());
-                if (first != second)
-                    return first > second;
-            }
-            if (lhs->GetHostileState() != rhs->GetHostileState())
-                return lhs->GetHostileState() > rhs->GetHostileState();
-            return lhs->getThreat() > rhs->getThreat(); // reverse sorting
-        });
+            Unit* left = lhs->getTarget();
+            Unit* right = rhs->getTarget();
+            if (left->IsPlayer() && !right->IsPlayer())
+                return true;
+            if (!left->IsPlayer() && right->IsPlayer())
+                return false;
+            bool attackLeft = owner->CanAttack(left);
+            bool attackRight = owner->CanAttack(right);
+            if (attackLeft && !attackRight)
+                return true;
+            if (!attackLeft && attackRight)
+                return false;
+        }
+        if (lhs->GetTauntState() != rhs->GetTauntState())
+            return lhs->GetTauntState() > rhs->GetTauntState();
+        if (force)
+        {
+            bool first = owner->CanReachWithMeleeAttack(lhs->getTarget());
+            bool second = owner->CanReachWithMeleeAttack(rhs->getTarget());
+            if (first != second)
+                return first > second;
+        }
+        if (lhs->GetHostileState() != rhs->GetHostileState())
+            return lhs->GetHostileState() > rhs->GetHostileState();
+        return lhs->getThreat() > rhs->getThreat(); // reverse sorting
+    };
+
+    if (force || isPlayer)
+        std::stable_sort(iThreatList.begin(), iThreatList.end(), comparator);
+    else if (iDirty || iChangedRefs.size() * 4 > iThreatList.size())
+    {
+        // taunt or hostile state changed or a big part of the list moved: the list is nearly sorted,
+        // stable insertion sort moves only misplaced references and needs ~n comparisons for it
+        for (size_t i = 1; i < iThreatList.size(); ++i)
+        {
+            HostileReference* ref = iThreatList[i];
+            size_t j = i;
+            for (; j > 0 && comparator(ref, iThreatList[j - 1]); --j)
+                iThreatList[j] = iThreatList[j - 1];
+            iThreatList[j] = ref;
+        }
+    }
+    else
+    {
+        // usual case: only threat of a few references changed since last update, the rest of the list
+        // is still sorted - take the changed ones out and put each back at its place by binary search
+        iThreatList.erase(std::remove_if(iThreatList.begin(), iThreatList.end(), [&](HostileReference const* ref)
+        {
+            return std::find(iChangedRefs.begin(), iChangedRefs.end(), ref) != iChangedRefs.end();
+        }), iThreatList.end());
+        for (HostileReference* ref : iChangedRefs)
+            iThreatList.insert(std::upper_bound(iThreatList.begin(), iThreatList.end(), ref, comparator), ref);
     }
+    iChangedRefs.clear();
     iDirty = false;
 }
 
@@ -339,9 +406,6 @@ HostileReference* ThreatContainer::selectNextVictim(Unit* attacker, HostileRefer
     if (suppressRanged && currentVictim)
         currentVictimInMelee = attacker->CanReachWithMeleeAttack(currentVictim->getTarget());
 
-    ThreatList::const_iterator lastRef = iThreatList.end();
-    --lastRef;
-
     for (ThreatList::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
     {
         currentRef = (*iter);
@@ -452,21 +516,40 @@ void ThreatManager::addThreat(Unit* victim, float threat, bool crit, SpellSchool
     // players and pets have only InHateListOf
     // HateOfflineList is used co contain unattackable victims (in-flight, in-water, GM etc.)
 
+    if (!CanAddThreat(victim))
+        return;
+
+    float calculatedThreat = ThreatCalcHelper::CalcThreat(victim, iOwner, threat, crit, schoolMask, threatSpell);
+
+    addThreatDirectly(victim, calculatedThreat, threatSpell && threatSpell->HasAttribute(SPELL_ATTR_EX_NO_THREAT));
+}
+
+void ThreatManager::addCalculatedThreat(Unit* victim, float calculatedThreat, SpellEntry const* threatSpell)
+{
+    if (!CanAddThreat(victim))
+        return;
+
+    if (getOwner()->GetTypeId() == TYPEID_PLAYER)           // players have entries with 0 threat during charm
+        calculatedThreat = 0.f;
+
+    addThreatDirectly(victim, calculatedThreat, threatSpell && threatSpell->HasAttribute(SPELL_ATTR_EX_NO_THREAT));
+}
+
+bool ThreatManager::CanAddThreat(Unit* victim) const
+{
     // not to self
     if (victim == getOwner())
-        return;
+        return false;
 
     // not to GM
     if (!victim || (victim->GetTypeId() == TYPEID_PLAYER && static_cast<Player*>(victim)->IsGameMaster()))
-        return;
+        return false;
 
     // not to dead and not for dead
     if (!victim->IsAlive() || !getOwner()->IsAlive())
-        return;
-
-    float calculatedThreat = ThreatCalcHelper::CalcThreat(victim, iOwner, threat, crit, schoolMask, threatSpell);
+        return false;
 
-    addThreatDirectly(victim, calculatedThreat, threatSpell && threatSpell->HasAttribute(SPELL_ATTR_EX_NO_THREAT));
+    return true;
 }
 
 void ThreatManager::addThreatDirectly(Unit* victim, float threat, bool noNew)
@@ -616,9 +699,8 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent& threatRefStat
     switch (threatRefStatusChangeEvent.getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
-            if ((getCurrentVictim() == hostileReference && threatRefStatusChangeEvent.getFValue() < 0.0f) ||
-                    (getCurrentVictim() != hostileReference && threatRefStatusChangeEvent.getFValue() > 0.0f))
-                setDirty(true);                             // the order in the threat list might have changed
+            if (hostileReference->isOnline())
+                iThreatContainer.setChanged(hostileReference); // the order in the threat list might have changed
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
             if (!hostileReference->isOnline())
@@ -633,8 +715,6 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent& threatRefStat
             }
             else
             {
-                if (getCurrentVictim() && hostileReference->getThreat() > (1.1f * getCurrentVictim()->getThreat()))
-                    setDirty(true);
                 iThreatContainer.addReference(hostileReference);
                 iThreatOfflineContainer.remove(hostileReference);
             }
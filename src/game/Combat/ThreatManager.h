@@ -24,7 +24,7 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "Entities/UnitEvents.h"
 #include "Entities/ObjectGuid.h"
-#include <list>
+#include <vector>
 
 //==============================================================
 
@@ -39,6 +39,8 @@ class ThreatCalcHelper
 {
     public:
         static float CalcThreat(Unit* hatedUnit, Unit* hatingUnit, float threat, bool crit, SpellSchoolMask schoolMask, SpellEntry const* threatSpell);
+        // part of the calculation that depends only on the hated unit, same result for every hating unit
+        static float CalcHatedUnitThreat(Unit* hatedUnit, float threat, bool crit, SpellSchoolMask schoolMask, SpellEntry const* threatSpell);
 };
 
 enum HostileState : uint32
@@ -143,7 +145,8 @@ class HostileReference : public Reference<Unit, ThreatManager>
 //==============================================================
 class ThreatManager;
 
-typedef std::list<HostileReference*> ThreatList;
+// contiguous and kept sorted by priority, so the most hated reference is always the front one
+typedef std::vector<HostileReference*> ThreatList;
 
 class ThreatContainer
 {
@@ -172,15 +175,18 @@ class ThreatContainer
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* ref) { iThreatList.remove(ref); }
-        void addReference(HostileReference* hostileReference) { iThreatList.push_back(hostileReference); }
+        void remove(HostileReference* ref);
+        void addReference(HostileReference* hostileReference);
         void clearReferences();
+        // Remember a reference whose threat changed, update() moves only those into place
+        void setChanged(HostileReference* hostileReference);
         // Sort the list if necessary
         void update(bool force, bool isPlayer);
 
         ThreatList iThreatList;
     private:
         bool iDirty;
+        ThreatList iChangedRefs;
 };
 
 //=================================================
@@ -201,6 +207,8 @@ class ThreatManager
 
         // add threat as raw value (ignore redirections and expection all mods applied already to it
         void addThreatDirectly(Unit* victim, float threat, bool noNew);
+        // add threat already modified by ThreatCalcHelper::CalcHatedUnitThreat, used for batched threat (see HostileRefManager::threatAssist)
+        void addCalculatedThreat(Unit* victim, float calculatedThreat, SpellEntry const* threatSpell);
 
         void modifyThreatPercent(Unit* victim, int32 threatPercent); // -101 removes whole ref, -100 sets threat to 0, rest modifies it
         void modifyAllThreatPercent(int32 threatPercent);
@@ -229,6 +237,8 @@ class ThreatManager
         void setDirty(bool dirty) { iThreatContainer.setDirty(dirty); }
 
         // Don't must be used for explicit modify threat values in iterator return pointers
+        // The list is a vector: loops that add, remove or move references (modifyThreatPercent, online status changes)
+        // must iterate over a copy
         ThreatList const& getThreatList() const { return iThreatContainer.getThreatList(); }
 
         void DeleteOutOfRangeReferences();
@@ -237,6 +247,7 @@ class ThreatManager
         void SetTargetSuppressed(Unit* target);
         void ClearSuppressed(HostileReference* except);
     private:
+        bool CanAddThreat(Unit* victim) const;
         void UpdateContainers();
 
         HostileReference* iCurrentVictim;
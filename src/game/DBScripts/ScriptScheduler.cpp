@@ -0,0 +1,177 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "DBScripts/ScriptScheduler.h"
+
+#include <algorithm>
+
+ScriptScheduler::ScriptScheduler() : m_nextTick(0), m_sequence(0), m_queued(0), m_stats()
+{
+    std::fill(std::begin(m_slots), std::end(m_slots), NO_NODE);
+}
+
+uint32 ScriptScheduler::Allocate()
+{
+    if (!m_freeNodes.empty())
+    {
+        uint32 const index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        return index;
+    }
+
+    m_pool.emplace_back();
+    return uint32(m_pool.size() - 1);
+}
+
+void ScriptScheduler::Free(uint32 index)
+{
+    m_freeNodes.push_back(index);
+}
+
+void ScriptScheduler::DropAction(uint32 index)
+{
+    Node& node = m_pool[index];
+    node.action.reset();
+
+    uint32 const last = m_live.back();
+    m_live[node.livePos] = last;
+    m_pool[last].livePos = node.livePos;
+    m_live.pop_back();
+}
+
+void ScriptScheduler::Schedule(TimePoint now, uint32 delay, ScriptAction const& action)
+{
+    // nothing queued, wheel may have been idle for long
+    if (!m_queued)
+        m_nextTick = TickOf(now);
+
+    uint32 const index = Allocate();
+    Node& node = m_pool[index];
+    node.action.emplace(action);
+    node.due = now + std::chrono::milliseconds(delay);
+    node.sequence = m_sequence++;
+    node.livePos = uint32(m_live.size());
+    m_live.push_back(index);
+
+    uint32& slot = m_slots[TickOf(node.due) % WHEEL_SLOTS];
+    node.next = slot;
+    slot = index;
+
+    ++m_queued;
+    ++m_stats.scheduled;
+}
+
+bool ScriptScheduler::HasScript(char const* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid) const
+{
+    for (uint32 index : m_live)
+        if (m_pool[index].action->IsSameScript(table, id, sourceGuid, targetGuid, ownerGuid))
+            return true;
+    return false;
+}
+
+void ScriptScheduler::Terminate(char const* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid)
+{
+    // nodes stay linked in their slot or the batch, and are freed when reached there
+    for (size_t i = m_live.size(); i > 0; --i)
+    {
+        uint32 const index = m_live[i - 1];
+        if (m_pool[index].action->IsSameScript(table, id, sourceGuid, targetGuid, ownerGuid))
+        {
+            DropAction(index);
+            --m_queued;
+            ++m_stats.terminated;
+        }
+    }
+}
+
+bool ScriptScheduler::CollectDue(uint64 fromTick, uint64 nowTick, TimePoint now)
+{
+    for (uint64 tick = fromTick; tick <= nowTick; ++tick)
+    {
+        uint32* link = &m_slots[tick % WHEEL_SLOTS];
+        while (*link != NO_NODE)
+        {
+            uint32 const index = *link;
+            Node& node = m_pool[index];
+            if (!node.action)
+            {
+                *link = node.next;
+                Free(index);
+            }
+            else if (node.due <= now)
+            {
+                *link = node.next;
+                m_batch.push_back(index);
+            }
+            else
+                link = &node.next;
+        }
+    }
+    return !m_batch.empty();
+}
+
+void ScriptScheduler::Process(TimePoint now)
+{
+    uint64 const nowTick = TickOf(now);
+    uint64 tick = m_nextTick;
+    if (nowTick >= tick + WHEEL_SLOTS)
+        tick = nowTick - WHEEL_SLOTS + 1;
+    m_nextTick = nowTick;
+
+    // the slot of nowTick is visited again next call as it may hold later steps of the same tick, it is also
+    // rescanned here after each batch: steps scheduled without delay by the batch run in this call, not a tick later
+    for (; CollectDue(tick, nowTick, now); tick = nowTick)
+    {
+        std::sort(m_batch.begin(), m_batch.end(), [this](uint32 left, uint32 right)
+        {
+            Node const& leftNode = m_pool[left];
+            Node const& rightNode = m_pool[right];
+            if (leftNode.due != rightNode.due)
+                return leftNode.due < rightNode.due;
+            return leftNode.sequence < rightNode.sequence;
+        });
+
+        for (uint32 index : m_batch)
+        {
+            // terminated by an earlier step of the batch
+            if (!m_pool[index].action)
+            {
+                Free(index);
+                continue;
+            }
+
+            // the step may schedule new steps and grow the pool
+            ScriptAction action = std::move(*m_pool[index].action);
+            DropAction(index);
+            Free(index);
+            --m_queued;
+            ++m_stats.executed;
+
+            if (action.HandleScriptStep())
+                Terminate(action.GetTableName(), action.GetId(), action.GetSourceGuid(), action.GetTargetGuid(), action.GetOwnerGuid());
+        }
+        m_batch.clear();
+    }
+}
+
+ScriptSchedulerStats ScriptScheduler::GetAndResetStats()
+{
+    ScriptSchedulerStats const stats = m_stats;
+    m_stats = ScriptSchedulerStats();
+    return stats;
+}
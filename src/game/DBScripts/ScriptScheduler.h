@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_SCRIPTSCHEDULER_H
+#define MANGOS_SCRIPTSCHEDULER_H
+
+#include "Common.h"
+#include "DBScripts/ScriptMgr.h"
+
+#include <optional>
+#include <vector>
+
+struct ScriptSchedulerStats
+{
+    uint64 scheduled;                                       // delayed script steps queued
+    uint64 executed;                                        // script steps run
+    uint64 terminated;                                      // queued steps dropped by a terminating script step
+};
+
+/*
+  @class ScriptScheduler
+  Map local queue of delayed db script steps, a hashed timer wheel of WHEEL_SLOTS slots of SLOT_MS each.
+  Steps are kept in a pooled node array linked per slot, so scheduling and expiry do not allocate once the
+  pool is warm. Steps due in a tick are collected from the passed slots and run as one batch, in due time
+  and then scheduling order, same as the former sorted multimap.
+ */
+class ScriptScheduler
+{
+    public:
+        ScriptScheduler();
+
+        void Schedule(TimePoint now, uint32 delay, ScriptAction const& action);
+
+        // true if a queued step belongs to the script, empty guids match any
+        bool HasScript(char const* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid) const;
+        // drops all queued steps of the script, empty guids match any
+        void Terminate(char const* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid);
+
+        // runs all steps due at now
+        void Process(TimePoint now);
+
+        bool IsEmpty() const { return m_queued == 0; }
+        uint32 GetQueuedCount() const { return m_queued; }
+
+        // counters since the previous call
+        ScriptSchedulerStats GetAndResetStats();
+
+    private:
+        static uint32 const WHEEL_SLOTS = 256;
+        static uint32 const SLOT_MS = 50;
+        static uint32 const NO_NODE = 0xFFFFFFFF;
+
+        struct Node
+        {
+            std::optional<ScriptAction> action;             // empty for free and terminated nodes
+            TimePoint due;
+            uint64 sequence;                                // scheduling order, for steps due at the same time
+            uint32 next;                                    // next node of the slot
+            uint32 livePos;                                 // position in m_live while the node holds an action
+        };
+
+        static uint64 TickOf(TimePoint time) { return uint64(time.time_since_epoch().count()) / SLOT_MS; }
+
+        uint32 Allocate();
+        void Free(uint32 index);
+        void DropAction(uint32 index);
+        // moves due nodes of the ticks up to nowTick into m_batch, returns false if there were none
+        bool CollectDue(uint64 fromTick, uint64 nowTick, TimePoint now);
+
+        std::vector<Node> m_pool;
+        std::vector<uint32> m_freeNodes;
+        std::vector<uint32> m_live;                         // nodes holding a not yet run step, unordered
+        uint32 m_slots[WHEEL_SLOTS];                        // first node per slot
+        std::vector<uint32> m_batch;                        // due nodes of the current Process call
+
+        uint64 m_nextTick;                                  // first wheel tick not fully processed
+        uint64 m_sequence;
+        uint32 m_queued;
+
+        ScriptSchedulerStats m_stats;
+};
+
+#endif
@@ -287,6 +287,18 @@ class CharacterHandler
 } chrHandler;
 
 void WorldSession::HandleCharEnum(QueryResult* result)
+{
+    // leave building the packet to the session workers, this runs in the world thread result queue processing
+    if (sWorld.HasSessionWorkers())
+    {
+        m_pendingCharEnums.push_back(result);
+        return;
+    }
+
+    BuildCharEnum(result);
+}
+
+void WorldSession::BuildCharEnum(QueryResult* result)
 {
     WorldPacket data(SMSG_CHAR_ENUM, 100);                  // we guess size
 
@@ -1556,16 +1556,25 @@ bool Creature::CreateFromProto(uint32 dbGuid, uint32 guidlow, CreatureInfo const
     return UpdateEntry(newEntry, data, eventData, false);
 }
 
-bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, GenericTransport* transport)
+bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, GenericTransport* /*transport*/)
 {
     CreatureData const* data = sObjectMgr.GetCreatureData(dbGuid);
-
     if (!data)
     {
         sLog.outErrorDb("Creature (GUID: %u) not found in table `creature`, can't load. ", dbGuid);
         return false;
     }
 
+    return LoadFromSpawnData(dbGuid, map, newGuid, forcedEntry, *data, nullptr);
+}
+
+bool Creature::LoadFromImage(CreatureSpawnImage const& spawn, Map* map, uint32 newGuid)
+{
+    return LoadFromSpawnData(spawn.dbGuid, map, newGuid, 0, spawn.data, spawn.cinfo);
+}
+
+bool Creature::LoadFromSpawnData(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, CreatureData const& data, CreatureInfo const* cinfo)
+{
     // Creature can be loaded already in map if grid has been unloaded while creature walk to another grid
     {
         Creature* existing = map->GetCreature(dbGuid);
@@ -1573,33 +1582,36 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
             return false;
     }
 
-    uint32 entry = forcedEntry ? forcedEntry : data->id;
-
-    // get data for dual spawn instances
-    if (entry == 0)
-        entry = GetCreatureConditionalSpawnEntry(dbGuid, map);
-
     SpawnGroupEntry* groupEntry = map->GetMapDataContainer().GetSpawnGroupByGuid(dbGuid, TYPEID_UNIT); // use dynguid by default \o/
     CreatureGroup* group = nullptr;
     if (groupEntry)
-    {
         group = static_cast<CreatureGroup*>(map->GetSpawnManager().GetSpawnGroup(groupEntry->Id));
-        if (!entry)
-            entry = group->GetGuidEntry(dbGuid);
-    }
 
     GameEventCreatureData const* eventData = sGameEventMgr.GetCreatureUpdateDataForActiveEvent(dbGuid);
-    if (!entry && eventData)
-        entry = eventData->entry_id;
 
-    if (!entry)
-        return false;
-
-    CreatureInfo const* cinfo = ObjectMgr::GetCreatureTemplate(entry);
     if (!cinfo)
     {
-        sLog.outErrorDb("Creature (Entry: %u) not found in table `creature_template`, can't load. ", entry);
-        return false;
+        uint32 entry = forcedEntry ? forcedEntry : data.id;
+
+        // get data for dual spawn instances
+        if (entry == 0)
+            entry = GetCreatureConditionalSpawnEntry(dbGuid, map);
+
+        if (!entry && group)
+            entry = group->GetGuidEntry(dbGuid);
+
+        if (!entry && eventData)
+            entry = eventData->entry_id;
+
+        if (!entry)
+            return false;
+
+        cinfo = ObjectMgr::GetCreatureTemplate(entry);
+        if (!cinfo)
+        {
+            sLog.outErrorDb("Creature (Entry: %u) not found in table `creature_template`, can't load. ", entry);
+            return false;
+        }
     }
 
     bool dynguid = false;
@@ -1614,9 +1626,9 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
     if (dynguid || newGuid == 0)
         newGuid = map->GenerateLocalLowGuid(cinfo->GetHighGuid());
 
-    CreatureCreatePos pos(map, data->posX, data->posY, data->posZ, data->orientation);
+    CreatureCreatePos pos(map, data.posX, data.posY, data.posZ, data.orientation);
 
-    if (!Create(dbGuid, newGuid, pos, cinfo, data, eventData))
+    if (!Create(dbGuid, newGuid, pos, cinfo, &data, eventData))
         return false;
 
     if (groupEntry)
@@ -1628,9 +1640,9 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
     }
 
     SetRespawnCoord(pos);
-    m_respawnradius = data->spawndist;
+    m_respawnradius = data.spawndist;
 
-    m_respawnDelay = data->GetRandomRespawnTime();
+    m_respawnDelay = data.GetRandomRespawnTime();
     bool isUsingNewSpawningSystem = IsUsingNewSpawningSystem();
     if (!isUsingNewSpawningSystem)
         m_corpseDelay = std::min(m_respawnDelay * 9 / 10, m_corpseDelay); // set corpse delay to 90% of the respawn delay
@@ -1648,9 +1660,9 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
         SetHealth(0);
         if (CanFly())
         {
-            float tz = GetTerrain()->GetHeightStatic(data->posX, data->posY, data->posZ, false);
-            if (data->posZ - tz > 0.1)
-                Relocate(data->posX, data->posY, tz);
+            float tz = GetTerrain()->GetHeightStatic(data.posX, data.posY, data.posZ, false);
+            if (data.posZ - tz > 0.1)
+                Relocate(data.posX, data.posY, tz);
         }
     }
     else if (m_respawnTime)                                 // respawn time set but expired
@@ -1671,9 +1683,9 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
             // Just set to dead, so need to relocate like above
             if (CanFly())
             {
-                float tz = GetTerrain()->GetHeightStatic(data->posX, data->posY, data->posZ, false);
-                if (data->posZ - tz > 0.1)
-                    Relocate(data->posX, data->posY, tz);
+                float tz = GetTerrain()->GetHeightStatic(data.posX, data.posY, data.posZ, false);
+                if (data.posZ - tz > 0.1)
+                    Relocate(data.posX, data.posY, tz);
             }
         }
     }
@@ -1682,8 +1694,8 @@ bool Creature::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forced
 
     AIM_Initialize();
 
-    if (data && data->spawnTemplate->relayId)
-        GetMap()->ScriptsStart(SCRIPT_TYPE_RELAY, data->spawnTemplate->relayId, this, nullptr);
+    if (data.spawnTemplate->relayId)
+        GetMap()->ScriptsStart(SCRIPT_TYPE_RELAY, data.spawnTemplate->relayId, this, nullptr);
 
     // Creature Linking, Initial load is handled like respawn
     if (m_isCreatureLinkingTrigger && IsAlive())
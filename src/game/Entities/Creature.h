@@ -26,6 +26,7 @@
 #include "Util/Util.h"
 #include "Entities/CreatureSpellList.h"
 #include "Entities/CreatureSettings.h"
+#include "Utilities/ObjectPool.h"
 
 #include <list>
 #include <memory>
@@ -41,6 +42,7 @@ class WorldSession;
 class CreatureGroup;
 
 struct GameEventCreatureData;
+struct CreatureSpawnImage;
 enum class VisibilityDistanceType : uint32;
 
 enum CreatureFlagsExtra
@@ -547,7 +549,7 @@ enum TemporaryFactionFlags                                  // Used at real fact
     TEMPFACTION_ALL,
 };
 
-class Creature : public Unit
+class Creature : public Unit, public PooledObject<Creature>
 {
     public:
 
@@ -704,6 +706,8 @@ class Creature : public Unit
         void SetDeathState(DeathState s) override;          // overwrite virtual Unit::SetDeathState
 
         bool LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, GenericTransport* transport = nullptr);
+        // grid load of a static spawn: spawn data and, for fixed entry spawns, the template come from the map spawn image
+        bool LoadFromImage(CreatureSpawnImage const& spawn, Map* map, uint32 newGuid);
         virtual void SaveToDB();
         // overwrited in Pet
         virtual void SaveToDB(uint32 mapid);
@@ -962,6 +966,9 @@ class Creature : public Unit
         bool m_imposedCooldown;
 
     private:
+        // cinfo is null unless the entry is fixed by the spawn data, it is then resolved here
+        bool LoadFromSpawnData(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, CreatureData const& data, CreatureInfo const* cinfo);
+
         GridReference<Creature> m_gridRef;
         CreatureInfo const* m_creatureInfo;
 };
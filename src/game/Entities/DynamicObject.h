@@ -23,6 +23,7 @@
 #include "Server/DBCEnums.h"
 #include "Spells/SpellTargetDefines.h"
 #include "Entities/Unit.h"
+#include "Utilities/ObjectPool.h"
 
 enum DynamicObjectType
 {
@@ -34,7 +35,7 @@ enum DynamicObjectType
 struct SpellEntry;
 struct AuraScript;
 
-class DynamicObject : public WorldObject
+class DynamicObject : public WorldObject, public PooledObject<DynamicObject>
 {
     public:
         explicit DynamicObject();
@@ -583,7 +583,7 @@ void GameObject::Update(const uint32 diff)
             switch (GetGoType())
             {
                 case GAMEOBJECT_TYPE_TRAP:
-                    if (m_events.GetEvents().size() > 0)
+                    if (m_events.HasEvents())
                     {
                         preventDespawn = true;
                         break;
@@ -866,30 +866,41 @@ void GameObject::SaveToDB(uint32 mapid) const
 bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry)
 {
     GameObjectData const* data = sObjectMgr.GetGOData(dbGuid);
-
     if (!data)
     {
         sLog.outErrorDb("Gameobject (GUID: %u) not found in table `gameobject`, can't load. ", dbGuid);
         return false;
     }
 
+    return LoadFromSpawnData(dbGuid, map, newGuid, forcedEntry, *data, nullptr);
+}
+
+bool GameObject::LoadFromImage(GameObjectSpawnImage const& spawn, Map* map, uint32 newGuid)
+{
+    return LoadFromSpawnData(spawn.dbGuid, map, newGuid, 0, spawn.data, spawn.goinfo);
+}
+
+bool GameObject::LoadFromSpawnData(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, GameObjectData const& data, GameObjectInfo const* goinfo)
+{
     // Gameobject can be loaded already in map if grid has been unloaded while gameobject moves to another grid
     if (map->GetGameObject(dbGuid))
         return false;
 
-    uint32 entry = forcedEntry ? forcedEntry : data->id;
-    // uint32 map_id = data->mapid;                         // already used before call
-    float x = data->posX;
-    float y = data->posY;
-    float z = data->posZ;
-    float ang = data->orientation;
+    // fixed entry spawns come with the template resolved by the spawn image and have no random entries
+    bool const resolved = goinfo != nullptr;
+    uint32 entry = forcedEntry ? forcedEntry : data.id;
+    // uint32 map_id = data.mapid;                          // already used before call
+    float x = data.posX;
+    float y = data.posY;
+    float z = data.posZ;
+    float ang = data.orientation;
 
-    float rotation0 = data->rotation0;
-    float rotation1 = data->rotation1;
-    float rotation2 = data->rotation2;
-    float rotation3 = data->rotation3;
+    float rotation0 = data.rotation0;
+    float rotation1 = data.rotation1;
+    float rotation2 = data.rotation2;
+    float rotation3 = data.rotation3;
 
-    uint32 animprogress = data->animprogress;
+    uint32 animprogress = data.animprogress;
 
     SpawnGroupEntry* groupEntry = map->GetMapDataContainer().GetSpawnGroupByGuid(dbGuid, TYPEID_GAMEOBJECT); // use dynguid by default \o/
     GameObjectGroup* group = nullptr;
@@ -905,7 +916,8 @@ bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forc
         dynguid = true;
     if (!dynguid)
     {
-        GameObjectInfo const* goinfo = ObjectMgr::GetGameObjectInfo(entry);
+        if (!resolved)
+            goinfo = ObjectMgr::GetGameObjectInfo(entry);
         if ((goinfo && (goinfo->ExtraFlags & GAMEOBJECT_EXTRA_FLAG_DYNGUID) != 0 || groupEntry) && dbGuid == newGuid)
             dynguid = true;
     }
@@ -913,14 +925,15 @@ bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forc
     if (dynguid || newGuid == 0)
         newGuid = map->GenerateLocalLowGuid(HIGHGUID_GAMEOBJECT);
 
-    if (uint32 randomEntry = sObjectMgr.GetRandomGameObjectEntry(dbGuid))
-        entry = randomEntry;
+    if (!resolved)
+        if (uint32 randomEntry = sObjectMgr.GetRandomGameObjectEntry(dbGuid))
+            entry = randomEntry;
 
     if (!Create(dbGuid, newGuid, entry, map, x, y, z, ang, rotation0, rotation1, rotation2, rotation3, animprogress, GO_STATE_READY))
         return false;
 
-    if (data->goState != -1)
-        SetGoState(GOState(data->goState));
+    if (data.goState != -1)
+        SetGoState(GOState(data.goState));
 
     if (group)
         SetGameObjectGroup(group);
@@ -928,7 +941,7 @@ bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forc
     if (groupEntry && groupEntry->StringId)
         SetStringId(groupEntry->StringId, true);
 
-    if (!GetGOInfo()->GetDespawnPossibility() && !GetGOInfo()->IsDespawnAtAction() && data->spawntimesecsmin >= 0)
+    if (!GetGOInfo()->GetDespawnPossibility() && !GetGOInfo()->IsDespawnAtAction() && data.spawntimesecsmin >= 0)
     {
         SetFlag(GAMEOBJECT_FLAGS, GO_FLAG_NODESPAWN);
         m_spawnedByDefault = true;
@@ -937,10 +950,10 @@ bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forc
     }
     else
     {
-        if (data->spawntimesecsmin >= 0)
+        if (data.spawntimesecsmin >= 0)
         {
             m_spawnedByDefault = true;
-            m_respawnDelay = data->GetRandomRespawnTime();
+            m_respawnDelay = data.GetRandomRespawnTime();
 
             m_respawnTime  = map->GetPersistentState()->GetGORespawnTime(GetDbGuid());
 
@@ -954,7 +967,7 @@ bool GameObject::LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forc
         else
         {
             m_spawnedByDefault = false;
-            m_respawnDelay = -data->spawntimesecsmin;
+            m_respawnDelay = -data.spawntimesecsmin;
             m_respawnTime = 0;
         }
     }
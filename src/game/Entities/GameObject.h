@@ -26,6 +26,7 @@
 #include "AI/BaseAI/GameObjectAI.h"
 #include "Spells/SpellDefines.h"
 #include "Spells/SpellAuras.h"
+#include "Utilities/ObjectPool.h"
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
 #if defined( __GNUC__ )
@@ -666,6 +667,7 @@ struct GameObjectDisplayInfoEntry;
 struct TransportAnimation;
 class Item;
 class GameObjectGroup;
+struct GameObjectSpawnImage;
 
 struct QuaternionData
 {
@@ -684,7 +686,7 @@ struct QuaternionData
 
 #define GO_ANIMPROGRESS_DEFAULT 100                         // in 3.x 0xFF
 
-class GameObject : public WorldObject
+class GameObject : public WorldObject, public PooledObject<GameObject>
 {
     public:
         explicit GameObject();
@@ -716,6 +718,8 @@ class GameObject : public WorldObject
         void SaveToDB() const;
         void SaveToDB(uint32 mapid) const;
         bool LoadFromDB(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry);
+        // grid load of a static spawn: spawn data and, for fixed entry spawns, the template come from the map spawn image
+        bool LoadFromImage(GameObjectSpawnImage const& spawn, Map* map, uint32 newGuid);
         void DeleteFromDB() const;
 
         ObjectGuid const& GetOwnerGuid() const override { return GetGuidValue(OBJECT_FIELD_CREATED_BY); }
@@ -948,6 +952,9 @@ class GameObject : public WorldObject
         void UpdateModel();                                 // updates model in case displayId were changed
         void UpdateCollisionState() const;                  // updates state in Map's dynamic collision tree
 
+        // goinfo is null unless the entry is fixed by the spawn data (no random entries), it is then resolved here
+        bool LoadFromSpawnData(uint32 dbGuid, Map* map, uint32 newGuid, uint32 forcedEntry, GameObjectData const& data, GameObjectInfo const* goinfo);
+
         GridReference<GameObject> m_gridRef;
 };
 
@@ -1026,7 +1026,8 @@ void Item::RemoveFromClientUpdateList()
 void Item::BuildUpdateData(UpdateDataMapType& update_players)
 {
     if (Player* pl = GetOwner())
-        BuildUpdateDataForPlayer(pl, update_players);
+        if (pl->GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
+            BuildUpdateDataForPlayer(pl, update_players);
 
     ClearUpdateMask(false);
 }
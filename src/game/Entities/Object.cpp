@@ -45,6 +45,110 @@
 #include "Spells/SpellMgr.h"
 #include "MotionGenerators/PathFinder.h"
 
+// values arrays of deleted objects are kept for next object with same values count (same object type),
+// one slab pool per values count used through caches of the allocating thread
+class ValuesArrayPool
+{
+    public:
+        ValuesArrayPool()
+        {
+            for (std::atomic<SlabPool*>& pool : m_pools)
+                pool = nullptr;
+        }
+
+        uint32* Allocate(uint16 count)
+        {
+            if (PoolThreadCache* cache = GetThreadCache(count))
+                return static_cast<uint32*>(cache->Allocate());
+            return static_cast<uint32*>(GetPool(count).Allocate());
+        }
+
+        void Free(uint32* values, uint16 count)
+        {
+            if (PoolThreadCache* cache = GetThreadCache(count))
+                cache->Free(values);
+            else
+                GetPool(count).Free(values);
+        }
+
+        ObjectPoolStats GetStats()
+        {
+            ObjectPoolStats stats = ObjectPoolStats();
+            for (std::atomic<SlabPool*>& pool : m_pools)
+            {
+                if (SlabPool* countPool = pool.load(std::memory_order_acquire))
+                {
+                    ObjectPoolStats const countStats = countPool->GetStats();
+                    stats.allocations += countStats.allocations;
+                    stats.reused += countStats.reused;
+                    stats.used += countStats.used;
+                    stats.free += countStats.free;
+                    stats.slabs += countStats.slabs;
+                    stats.released += countStats.released;
+                }
+            }
+            return stats;
+        }
+
+    private:
+        static size_t const SLAB_ARRAYS = 64;
+
+        SlabPool& GetPool(uint16 count)
+        {
+            MANGOS_ASSERT(count <= PLAYER_END);
+            std::atomic<SlabPool*>& pool = m_pools[count];
+            if (SlabPool* existing = pool.load(std::memory_order_acquire))
+                return *existing;
+
+            std::lock_guard<std::mutex> guard(m_createLock);
+            if (!pool.load(std::memory_order_relaxed))
+                pool.store(new SlabPool(count * sizeof(uint32), SLAB_ARRAYS), std::memory_order_release);
+            return *pool.load(std::memory_order_relaxed);
+        }
+
+        // null once the thread caches are destroyed at thread exit, later frees go to the shared pools
+        PoolThreadCache* GetThreadCache(uint16 count)
+        {
+            static thread_local bool destroyed = false;
+            if (destroyed)
+                return nullptr;
+
+            struct Holder
+            {
+                ~Holder()
+                {
+                    destroyed = true;
+                    for (auto& cache : caches)
+                        delete cache.second;
+                }
+                std::vector<std::pair<uint16, PoolThreadCache*>> caches; // few values counts, one per object type
+            };
+            static thread_local Holder holder;
+
+            for (auto& cache : holder.caches)
+                if (cache.first == count)
+                    return cache.second;
+
+            holder.caches.emplace_back(count, new PoolThreadCache(GetPool(count)));
+            return holder.caches.back().second;
+        }
+
+        std::atomic<SlabPool*> m_pools[PLAYER_END + 1];     // by values count, created on first use and never destroyed
+        std::mutex m_createLock;
+};
+
+static ValuesArrayPool& GetValuesArrayPool()
+{
+    // never destroyed, objects may still be deleted by other singletons at exit
+    static ValuesArrayPool* pool = new ValuesArrayPool();
+    return *pool;
+}
+
+ObjectPoolStats Object::GetValuesArrayPoolStats()
+{
+    return GetValuesArrayPool().GetStats();
+}
+
 Object::Object(): m_updateFlag(0), m_itsNewObject(false), m_dbGuid(0)
 {
     m_objectTypeId      = TYPEID_OBJECT;
@@ -73,17 +177,18 @@ Object::~Object()
         MANGOS_ASSERT(false);
     }
 
-    delete[] m_uint32Values;
+    if (m_uint32Values)
+        GetValuesArrayPool().Free(m_uint32Values, m_valuesCount);
 
     delete m_loot;
 }
 
 void Object::_InitValues()
 {
-    m_uint32Values = new uint32[ m_valuesCount ];
+    m_uint32Values = GetValuesArrayPool().Allocate(m_valuesCount);
     memset(m_uint32Values, 0, m_valuesCount * sizeof(uint32));
 
-    m_changedValues.resize(m_valuesCount, false);
+    m_changedValues.assign((m_valuesCount + 31) / 32, 0);
 
     m_objectUpdated = false;
 }
@@ -191,6 +296,9 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
 
 void Object::SendCreateUpdateToPlayer(Player* player) const
 {
+    if (!player->GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
+        return;
+
     // send create update to player
     UpdateData updateData;
     BuildCreateUpdateBlockForPlayer(&updateData, player);
@@ -400,10 +508,11 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
     // 2 specialized loops for speed optimization in non-unit case
     if (isType(TYPEMASK_UNIT))                              // unit (creature/player) case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint32 block = 0; block < updateMask->GetBlockCount(); ++block)
         {
-            if (updateMask->GetBit(index))
+            for (uint32 bits = updateMask->GetBlock(block); bits; bits &= bits - 1)
             {
+                uint16 index = uint16(block * 32 + UpdateMask::LowestBit(bits));
                 if (index == UNIT_NPC_FLAGS)
                 {
                     uint32 appendValue = m_uint32Values[index];
@@ -612,10 +721,11 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
     }
     else if (isType(TYPEMASK_CORPSE))                       // corpse case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint32 block = 0; block < updateMask->GetBlockCount(); ++block)
         {
-            if (updateMask->GetBit(index))
+            for (uint32 bits = updateMask->GetBlock(block); bits; bits &= bits - 1)
             {
+                uint16 index = uint16(block * 32 + UpdateMask::LowestBit(bits));
                 if (index == CORPSE_FIELD_BYTES_1)
                 {
                     uint32 value = m_uint32Values[index];
@@ -645,10 +755,11 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
     }
     else if (isType(TYPEMASK_GAMEOBJECT))                   // gameobject case
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint32 block = 0; block < updateMask->GetBlockCount(); ++block)
         {
-            if (updateMask->GetBit(index))
+            for (uint32 bits = updateMask->GetBlock(block); bits; bits &= bits - 1)
             {
+                uint16 index = uint16(block * 32 + UpdateMask::LowestBit(bits));
                 // send in current format (float as float, uint32 as uint32)
                 if (index == GAMEOBJECT_DYN_FLAGS)
                 {
@@ -686,10 +797,11 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
     }
     else                                                    // other objects case (no special index checks)
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        for (uint32 block = 0; block < updateMask->GetBlockCount(); ++block)
         {
-            if (updateMask->GetBit(index))
+            for (uint32 bits = updateMask->GetBlock(block); bits; bits &= bits - 1)
             {
+                uint16 index = uint16(block * 32 + UpdateMask::LowestBit(bits));
                 // send in current format (float as float, uint32 as uint32)
                 *data << m_uint32Values[index];
             }
@@ -699,11 +811,7 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
 
 void Object::ClearUpdateMask(bool remove)
 {
-    if (m_uint32Values)
-    {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
-            m_changedValues[index] = false;
-    }
+    std::fill(m_changedValues.begin(), m_changedValues.end(), 0);
 
     if (m_objectUpdated)
     {
@@ -797,9 +905,18 @@ void Object::_SetUpdateBits(UpdateMask& updateMask, Player* target) const
     uint16 visibleFlag = GetUpdateFieldFlagsForTarget(target, flags);
     MANGOS_ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-        if (m_changedValues[index] && (flags[index] & visibleFlag))
-            updateMask.SetBit(index);
+    // only walk changed fields, most objects have a few of them among hundreds
+    for (uint32 block = 0; block < m_changedValues.size(); ++block)
+    {
+        uint32 visibleBits = 0;
+        for (uint32 bits = m_changedValues[block]; bits; bits &= bits - 1)
+        {
+            uint32 bit = UpdateMask::LowestBit(bits);
+            if (flags[block * 32 + bit] & visibleFlag)
+                visibleBits |= 1u << bit;
+        }
+        updateMask.SetBlock(block, visibleBits);
+    }
 }
 
 void Object::_SetCreateBits(UpdateMask& updateMask, Player* target) const
@@ -820,7 +937,7 @@ void Object::SetInt32Value(uint16 index, int32 value)
     if (m_int32Values[index] != value)
     {
         m_int32Values[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -832,7 +949,7 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
     if (m_uint32Values[index] != value)
     {
         m_uint32Values[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -844,8 +961,8 @@ void Object::SetUInt64Value(uint16 index, const uint64& value)
     {
         m_uint32Values[index] = *((uint32*)&value);
         m_uint32Values[index + 1] = *(((uint32*)&value) + 1);
-        m_changedValues[index] = true;
-        m_changedValues[index + 1] = true;
+        MarkChangedValue(index);
+        MarkChangedValue(index + 1);
         MarkForClientUpdate();
     }
 }
@@ -857,7 +974,7 @@ void Object::SetFloatValue(uint16 index, float value)
     if (m_floatValues[index] != value)
     {
         m_floatValues[index] = value;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -876,7 +993,7 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFF) << (offset * 8));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -895,7 +1012,7 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFFFF) << (offset * 16));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 16));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -957,7 +1074,7 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -971,7 +1088,7 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -989,7 +1106,7 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
     if (!(uint8(m_uint32Values[index] >> (offset * 8)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1007,7 +1124,7 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
     if (uint8(m_uint32Values[index] >> (offset * 8)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (offset * 8));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1019,7 +1136,7 @@ void Object::SetShortFlag(uint16 index, bool highpart, uint16 newFlag)
     if (!(uint16(m_uint32Values[index] >> (highpart ? 16 : 0)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (highpart ? 16 : 0));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1031,7 +1148,7 @@ void Object::RemoveShortFlag(uint16 index, bool highpart, uint16 oldFlag)
     if (uint16(m_uint32Values[index] >> (highpart ? 16 : 0)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (highpart ? 16 : 0));
-        m_changedValues[index] = true;
+        MarkChangedValue(index);
         MarkForClientUpdate();
     }
 }
@@ -1099,7 +1216,7 @@ void Object::MarkForClientUpdate()
 
 void Object::ForceValuesUpdateAtIndex(uint16 index)
 {
-    m_changedValues[index] = true;
+    MarkChangedValue(index);
     if (m_inWorld && !m_objectUpdated)
     {
         AddToClientUpdateList();
@@ -1151,10 +1268,18 @@ WorldObject::WorldObject() :
     m_transport(nullptr), m_isOnEventNotified(false),
     m_visibilityData(this), m_currMap(nullptr),
     m_mapId(0), m_InstanceId(0),
+    m_positionIndex(nullptr), m_positionIndexSlot(0), m_lodSkippedDiff(0),
     m_isActiveObject(false), m_debugFlags(0), m_castCounter(0)
 {
 }
 
+WorldObject::~WorldObject()
+{
+    // normally already removed with grid reference, keep the index free of dangling pointers anyway
+    if (m_positionIndex)
+        m_positionIndex->Remove(this);
+}
+
 void WorldObject::CleanupsBeforeDelete()
 {
     m_events.KillAllEvents(false);                      // non-delatable (currently casted spells) will not deleted now but it will deleted at call in Map::RemoveAllObjectsInRemoveList
@@ -1185,6 +1310,8 @@ void WorldObject::Relocate(float x, float y, float z, float orientation)
 
     if (isType(TYPEMASK_UNIT))
         m_movementInfo.ChangePosition(x, y, z, orientation);
+
+    UpdatePositionIndex();
 }
 
 void WorldObject::Relocate(float x, float y, float z)
@@ -1195,6 +1322,14 @@ void WorldObject::Relocate(float x, float y, float z)
 
     if (isType(TYPEMASK_UNIT))
         m_movementInfo.ChangePosition(x, y, z, GetOrientation());
+
+    UpdatePositionIndex();
+}
+
+void WorldObject::UpdatePositionIndex()
+{
+    if (m_positionIndex)
+        m_positionIndex->Update(m_positionIndexSlot, m_position.x, m_position.y, GetPositionIndexRadius());
 }
 
 void WorldObject::SetOrientation(float orientation)
@@ -1900,6 +2035,7 @@ void WorldObject::SendMessageToSetExcept(WorldPacket const& data, Player const*
     {
         MaNGOS::MessageDelivererExcept notifier(data, skipped_receiver);
         Cell::VisitWorldObjects(this, notifier, GetMap()->GetVisibilityDistance());
+        notifier.Deliver();
     }
 }
 
@@ -2471,7 +2607,8 @@ struct WorldObjectChangeAccumulator
 #ifdef ENABLE_PLAYERBOTS
             if (plr->isRealPlayer())
 #endif
-            i_object.BuildUpdateDataForPlayer(plr, i_updateDatas);
+            if (plr->GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
+                i_object.BuildUpdateDataForPlayer(plr, i_updateDatas);
         }
     }
 
@@ -2484,7 +2621,7 @@ struct WorldObjectChangeAccumulator
             if (owner->isRealPlayer())
             {
 #endif
-            if (owner != &i_object && owner->HasAtClient(&i_object))
+            if (owner != &i_object && owner->HasAtClient(&i_object) && owner->GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
                 i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
 #ifdef ENABLE_PLAYERBOTS
             }
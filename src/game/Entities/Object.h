@@ -33,6 +33,7 @@
 #include "Entities/ObjectVisibility.h"
 #include "Grids/Cell.h"
 #include "Utilities/EventProcessor.h"
+#include "Utilities/ObjectPool.h"
 
 #include <set>
 
@@ -110,8 +111,9 @@ struct ItemPrototype;
 class ChatHandler;
 struct SpellEntry;
 class GenericTransport;
+class CellPositionIndex;
 
-typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
+typedef MaNGOS::OpenHashMap<Player*, UpdateData> UpdateDataMapType;
 
 class CooldownData
 {
@@ -608,6 +610,9 @@ class Object
 
         uint16 GetValuesCount() const { return m_valuesCount; }
 
+        // update field arrays are reused between objects of same type
+        static ObjectPoolStats GetValuesArrayPoolStats();
+
         virtual bool HasQuest(uint32 /* quest_id */) const { return false; }
         virtual bool HasInvolvedQuest(uint32 /* quest_id */) const { return false; }
         void SetItsNewObject(bool enable) { m_itsNewObject = enable; }
@@ -646,7 +651,9 @@ class Object
             float*  m_floatValues;
         };
 
-        std::vector<bool> m_changedValues;
+        std::vector<uint32> m_changedValues;                // dirty bitset of update fields, 32 fields per block
+
+        void MarkChangedValue(uint16 index) { m_changedValues[index >> 5] |= 1u << (index & 0x1F); }
 
         uint16 m_valuesCount;
 
@@ -875,9 +882,11 @@ inline ByteBuffer& operator>> (ByteBuffer& buf, MovementInfo& mi)
 class WorldObject : public Object
 {
         friend struct WorldObjectChangeAccumulator;
+        friend class CellPositionIndex;
+        friend class UpdateLodScheduler;
 
     public:
-        virtual ~WorldObject() {}
+        virtual ~WorldObject();
 
         virtual void Update(const uint32 /*diff*/);
         virtual void Heartbeat() {}
@@ -887,6 +896,9 @@ class WorldObject : public Object
 
         void Relocate(float x, float y, float z, float orientation);
         void Relocate(float x, float y, float z);
+        void UpdatePositionIndex();                         // refresh entry of the cell position index, called at relocation and bounding radius or combat reach change
+        // size padding of range searches through the cell position index, covers both the IsWithinDist (combat reach) and bounding radius distances
+        float GetPositionIndexRadius() const { return std::max(GetCombatReach(), GetObjectBoundingRadius()); }
 
         void SetOrientation(float orientation);
 
@@ -1218,6 +1230,9 @@ class WorldObject : public Object
         uint32 m_InstanceId;                                // in map copy with instance id
 
         Position m_position;
+        CellPositionIndex* m_positionIndex;                 // position index of the grid cell listing the object, if any
+        uint32 m_positionIndexSlot;
+        uint32 m_lodSkippedDiff;                            // time of map updates skipped by UpdateLodScheduler since the last Update()
         ViewPoint m_viewPoint;
         bool m_isActiveObject;
         uint64 m_debugFlags;
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Util/ByteBuffer.h"
+#include "Util/OpenHashMap.h"
 #include <atomic>
 
 enum TypeID
@@ -257,4 +258,7 @@ namespace std
     };
 }
 
+// flat hash set for hot guid lookups, unordered
+typedef MaNGOS::OpenHashSet<ObjectGuid> GuidHashSet;
+
 #endif
@@ -17901,7 +17901,8 @@ void Player::UpdateVisibilityOf(WorldObject const* viewPoint, T* target, UpdateD
             if (target->GetTypeId() == TYPEID_UNIT)
                 BeforeVisibilityDestroy(dynamic_cast<Creature*>(target));
 
-            target->BuildOutOfRangeUpdateBlock(&data);
+            if (GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
+                target->BuildOutOfRangeUpdateBlock(&data);
             RemoveAtClient(target);
 
             DEBUG_FILTER_LOG(LOG_FILTER_VISIBILITY_CHANGES, "UpdateVisibilityOf(TemplateV): %s is out of range for %s. Distance = %f", t_guid.GetString().c_str(), GetGuidStr().c_str(), GetDistance(target));
@@ -17912,7 +17913,8 @@ void Player::UpdateVisibilityOf(WorldObject const* viewPoint, T* target, UpdateD
         if (target->isVisibleForInState(this, viewPoint, false))
         {
             visibleNow.insert(target);
-            target->BuildCreateUpdateBlockForPlayer(&data, this);
+            if (GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
+                target->BuildCreateUpdateBlockForPlayer(&data, this);
             AddAtClient(target);
 
             DEBUG_FILTER_LOG(LOG_FILTER_VISIBILITY_CHANGES, "UpdateVisibilityOf(TemplateV): %s is visible now for %s. Distance = %f", target->GetGuidStr().c_str(), GetGuidStr().c_str(), GetDistance(target));
@@ -2068,7 +2068,7 @@ class Player : public Unit
         bool HasAtClient(WorldObject const* u) { return u == this || m_clientGUIDs.find(u->GetObjectGuid()) != m_clientGUIDs.end(); }
         void AddAtClient(WorldObject* target);
         void RemoveAtClient(WorldObject* target);
-        GuidSet& GetClientGuids() { return m_clientGUIDs; }
+        GuidHashSet& GetClientGuids() { return m_clientGUIDs; }
 
         bool IsVisibleInGridForPlayer(Player* pl) const override;
         bool IsVisibleGloballyFor(Player* u) const;
@@ -2550,7 +2550,7 @@ class Player : public Unit
         Spell* m_modsSpell;
         std::set<SpellModifierPair>* m_consumedMods;
 
-        GuidSet m_clientGUIDs;
+        GuidHashSet m_clientGUIDs;
 
         std::unordered_map<uint32, TimePoint> m_enteredInstances;
         uint32 m_createdInstanceClearTimer;
@@ -326,6 +326,7 @@ Unit::Unit() :
     m_spellUpdateHappening(false),
     m_spellProcsHappening(false),
     m_hasHeartbeatProcCounter(0),
+    m_procHolderFlags(0),
     m_ignoreRangedTargets(false),
     m_auraUpdateMask(0),
     m_combatManager(this)
@@ -337,6 +338,8 @@ Unit::Unit() :
     m_attackTimer[BASE_ATTACK]   = 0;
     m_attackTimer[OFF_ATTACK]    = 0;
     m_attackTimer[RANGED_ATTACK] = 0;
+
+    std::fill(std::begin(m_modAuraArrayEnd), std::end(m_modAuraArrayEnd), uint16(0));
     m_modAttackSpeedPct[BASE_ATTACK] = 1.0f;
     m_modAttackSpeedPct[OFF_ATTACK] = 1.0f;
     m_modAttackSpeedPct[RANGED_ATTACK] = 1.0f;
@@ -4433,8 +4436,10 @@ int32 Unit::GetTotalAuraModifier(AuraType auratype) const
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
         modifier += i->GetModifier()->m_amount;
 
     return modifier;
@@ -4444,8 +4449,10 @@ float Unit::GetTotalAuraMultiplier(AuraType auratype) const
 {
     float multiplier = 1.0f;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return multiplier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
         multiplier *= (100.0f + i->GetModifier()->m_amount) / 100.0f;
 
     return multiplier;
@@ -4455,8 +4462,10 @@ int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype) const
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
         if (i->GetModifier()->m_amount > modifier)
             modifier = i->GetModifier()->m_amount;
 
@@ -4467,8 +4476,10 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
         if (i->GetModifier()->m_amount < modifier)
             modifier = i->GetModifier()->m_amount;
 
@@ -4482,8 +4493,10 @@ int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask)
 
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue & misc_mask)
@@ -4499,8 +4512,10 @@ float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask
 
     float multiplier = 1.0f;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return multiplier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue & misc_mask)
@@ -4516,8 +4531,10 @@ int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auratype, uint32 misc_
 
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue & misc_mask && mod->m_amount > modifier)
@@ -4534,8 +4551,10 @@ int32 Unit::GetMaxNegativeAuraModifierByMiscMask(AuraType auratype, uint32 misc_
 
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue & misc_mask && mod->m_amount < modifier)
@@ -4549,8 +4568,10 @@ int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auratype, int32 misc_value)
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue == misc_value)
@@ -4563,8 +4584,10 @@ float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auratype, int32 misc_valu
 {
     float multiplier = 1.0f;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return multiplier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue == misc_value)
@@ -4577,8 +4600,10 @@ int32 Unit::GetMaxPositiveAuraModifierByMiscValue(AuraType auratype, int32 misc_
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue == misc_value && mod->m_amount > modifier)
@@ -4592,8 +4617,10 @@ int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auratype, int32 misc_
 {
     int32 modifier = 0;
 
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
+    if (!m_modAuraTypes[auratype])
+        return modifier;
+
+    for (Aura* i : GetModAuraSpan(auratype))
     {
         Modifier* mod = i->GetModifier();
         if (mod->m_miscvalue == misc_value && mod->m_amount < modifier)
@@ -4765,6 +4792,7 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     holder->_AddSpellAuraHolder();
     holder->SetCreationDelayFlag();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    AddToProcHolderIndex(holder);
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -4786,10 +4814,66 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     return true;
 }
 
+void Unit::AddToProcHolderIndex(SpellAuraHolder* holder)
+{
+    uint32 procFlags = sSpellMgr.GetSpellProcFlags(holder->GetSpellProto());
+    if (!procFlags)
+        return;
+
+    // keep same order as m_spellAuraHolders (by spell id, then by insertion) so proc order does not change
+    uint32 spellId = holder->GetId();
+    auto itr = std::upper_bound(m_procHolderIndex.begin(), m_procHolderIndex.end(), spellId,
+        [](uint32 id, ProcHolderIndexEntry const& entry) { return id < entry.holder->GetId(); });
+    m_procHolderIndex.emplace(itr, holder, procFlags);
+    m_procHolderFlags |= procFlags;
+}
+
+void Unit::RemoveFromProcHolderIndex(SpellAuraHolder* holder)
+{
+    auto itr = std::find_if(m_procHolderIndex.begin(), m_procHolderIndex.end(), [holder](ProcHolderIndexEntry const& entry) { return entry.holder == holder; });
+    if (itr == m_procHolderIndex.end())
+        return;
+
+    m_procHolderIndex.erase(itr);
+
+    m_procHolderFlags = 0;
+    for (ProcHolderIndexEntry const& entry : m_procHolderIndex)
+        m_procHolderFlags |= entry.procFlags;
+}
+
 void Unit::AddAuraToModList(Aura* aura)
 {
     if (aura->GetModifier()->m_auraname < TOTAL_AURAS)
-        m_modAuras[aura->GetModifier()->m_auraname].push_back(aura);
+        LinkModAura(AuraType(aura->GetModifier()->m_auraname), aura);
+}
+
+void Unit::LinkModAura(AuraType type, Aura* aura)
+{
+    m_modAuras[type].push_back(aura);
+    m_modAuraTypes[type] = true;
+
+    m_modAuraArray.insert(m_modAuraArray.begin() + m_modAuraArrayEnd[type], aura);
+    for (uint32 i = type; i < TOTAL_AURAS; ++i)
+        ++m_modAuraArrayEnd[i];
+}
+
+void Unit::UnlinkModAura(AuraType type, Aura* aura)
+{
+    AuraList& list = m_modAuras[type];
+    list.remove(aura);
+    m_modAuraTypes[type] = !list.empty();
+
+    for (;;)
+    {
+        ModAuraSpan const span = GetModAuraSpan(type);
+        Aura* const* found = std::find(span.begin(), span.end(), aura);
+        if (found == span.end())
+            break;
+
+        m_modAuraArray.erase(m_modAuraArray.begin() + (found - m_modAuraArray.data()));
+        for (uint32 i = type; i < TOTAL_AURAS; ++i)
+            --m_modAuraArrayEnd[i];
+    }
 }
 
 void Unit::RemoveRankAurasDueToSpell(uint32 spellId)
@@ -5263,6 +5347,7 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
             break;
         }
     }
+    RemoveFromProcHolderIndex(holder);
 
     holder->SetRemoveMode(mode);
     holder->UnregisterAndCleanupTrackedAuras();
@@ -5321,9 +5406,7 @@ void Unit::RemoveAura(Aura* Aur, AuraRemoveMode mode)
 {
     // remove from list before mods removing (prevent cyclic calls, mods added before including to aura list - use reverse order)
     if (Aur->GetModifier()->m_auraname < TOTAL_AURAS)
-    {
-        m_modAuras[Aur->GetModifier()->m_auraname].remove(Aur);
-    }
+        UnlinkModAura(AuraType(Aur->GetModifier()->m_auraname), Aur);
 
     // Set remove mode
     Aur->SetRemoveMode(mode);
@@ -5442,7 +5525,7 @@ void Unit::_ApplyAllAuraMods()
 
 bool Unit::HasAuraType(AuraType auraType) const
 {
-    return !GetAurasByType(auraType).empty();
+    return m_modAuraTypes[auraType];
 }
 
 bool Unit::HasAffectedAura(AuraType auraType, SpellEntry const* spellInfo) const
@@ -8182,7 +8265,7 @@ void Unit::UpdateVisibilityAndView()
 
             if (!owner || !IsVisibleForOrDetect(owner, this, false))
             {
-                alist.erase(it);
+                UnlinkModAura(*type, aura);
                 RemoveAura(aura);
                 it = alist.begin();
             }
@@ -9234,11 +9317,10 @@ void Unit::ApplyMaxPowerMod(Powers power, uint32 val, bool apply)
 
 void Unit::ApplyAuraProcTriggerDamage(Aura* aura, bool apply)
 {
-    AuraList& tAuraProcTriggerDamage = m_modAuras[SPELL_AURA_PROC_TRIGGER_DAMAGE];
     if (apply)
-        tAuraProcTriggerDamage.push_back(aura);
+        LinkModAura(SPELL_AURA_PROC_TRIGGER_DAMAGE, aura);
     else
-        tAuraProcTriggerDamage.remove(aura);
+        UnlinkModAura(SPELL_AURA_PROC_TRIGGER_DAMAGE, aura);
 }
 
 uint32 Unit::GetCreatePowers(Powers power) const
@@ -10136,8 +10218,8 @@ void Unit::UpdateModelData()
         float normalizedScale = nativeScale != 0 ? currentScale / nativeScale : 1;
         // vanilla only - values need to be relative to either DBC scale for players or DB scale for creatures
         SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, normalizedScale * modelInfo->bounding_radius);
-
         SetFloatValue(UNIT_FIELD_COMBATREACH, normalizedScale * modelInfo->combat_reach);
+        UpdatePositionIndex();
 
         SetBaseWalkSpeed(modelInfo->SpeedWalk);
         SetBaseRunSpeed(modelInfo->SpeedRun, false);
@@ -10527,6 +10609,10 @@ void Unit::SendTeleportPacket(float x, float y, float z, float ori, GenericTrans
         player->GetSession()->IncrementOrderCounter();
     }
 
+    // a state update relayed after the teleport would move the unit back for observers
+    if (IsInWorld())
+        GetMap()->GetMovementRelay().Discard(GetObjectGuid());
+
     WorldPacket moveUpdateTeleport(MSG_MOVE_TELEPORT, 38);
     moveUpdateTeleport << GetPackGUID();
     teleportMovementInfo.Write(moveUpdateTeleport);
@@ -10789,13 +10875,14 @@ SpellAuraHolder* Unit::GetSpellAuraHolder(uint32 spellid, ObjectGuid casterGuid)
     return nullptr;
 }
 
-class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
+class UnitVisitObjectsInRangeNotifyEvent : public PooledBasicEvent<UnitVisitObjectsInRangeNotifyEvent>
 {
     public:
-        UnitVisitObjectsInRangeNotifyEvent(Unit& owner) : BasicEvent(), m_owner(owner) {}
+        UnitVisitObjectsInRangeNotifyEvent(Unit& owner) : m_owner(owner), m_executing(false), m_rescheduled(false), m_rescheduleDelay(0) {}
 
         bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
         {
+            m_executing = true;
             float radius = std::max(m_owner.GetDetectionRange(), uint32(MAX_CREATURE_ATTACK_RADIUS)) * sWorld.getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO);
             if (m_owner.IsPlayer())
             {
@@ -10810,6 +10897,15 @@ class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
                 MaNGOS::CreatureVisitObjectsNotifier notify(creature);
                 Cell::VisitAllObjects(&m_owner, notify, radius);
             }
+            m_executing = false;
+
+            // forced reschedule requested by the visit itself, event is already out of the queue - add it again
+            if (m_rescheduled)
+            {
+                m_rescheduled = false;
+                m_owner.m_events.AddEvent(this, m_owner.m_events.CalculateTime(m_rescheduleDelay));
+                return false;
+            }
             m_owner.FinalizeAINotifyEvent();
             return true;
         }
@@ -10819,8 +10915,23 @@ class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
             m_owner.FinalizeAINotifyEvent();
         }
 
+        // returns false if the event is not executing and can be rescheduled in the queue directly
+        bool RescheduleWhileExecuting(uint32 delay)
+        {
+            if (!m_executing)
+                return false;
+            m_rescheduled = true;
+            m_rescheduleDelay = delay;
+            return true;
+        }
+
+        void CancelReschedule() { m_rescheduled = false; }
+
     private:
         Unit & m_owner;
+        bool m_executing;
+        bool m_rescheduled;
+        uint32 m_rescheduleDelay;
 };
 
 void Unit::ScheduleAINotify(uint32 delay, bool forced)
@@ -10830,11 +10941,10 @@ void Unit::ScheduleAINotify(uint32 delay, bool forced)
         m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this);
         m_events.AddEvent(m_AINotifyEvent, m_events.CalculateTime(delay));
     }
-    else if (forced)
+    else if (forced)                                        // just reschedule already queued event
     {
-        m_events.KillEvent(m_AINotifyEvent);
-        m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this);
-        m_events.AddEvent(m_AINotifyEvent, m_events.CalculateTime(delay));
+        if (!static_cast<UnitVisitObjectsInRangeNotifyEvent*>(m_AINotifyEvent)->RescheduleWhileExecuting(delay))
+            m_events.ModifyEventTime(m_AINotifyEvent, m_events.CalculateTime(delay));
     }
 }
 
@@ -10842,6 +10952,7 @@ void Unit::AbortAINotifyEvent()
 {
     if (m_AINotifyEvent)
     {
+        static_cast<UnitVisitObjectsInRangeNotifyEvent*>(m_AINotifyEvent)->CancelReschedule();
         m_events.KillEvent(m_AINotifyEvent);
         m_AINotifyEvent = nullptr;
     }
@@ -11335,7 +11446,7 @@ bool Unit::TakeCharmOf(Unit* charmed, uint32 spellId, bool advertised /*= true*/
         sLog.outCustomLog("Unit didnt equal in Unit::TakeCharmOf after attackability changes.");
 
     // put charmed in combat with all charmers enemies - must be done after flags
-    ThreatList const& list = getThreatManager().getThreatList();
+    ThreatList const list = getThreatManager().getThreatList(); // copy - entering combat can change our own list
     for (auto& data : list)
     {
         Unit* enemy = data->getTarget();
@@ -11690,11 +11801,17 @@ void Unit::InterruptSpellsCastedOnMe(bool killDelayed)
         if (!killDelayed)
             continue;
         // 2/ Interrupt spells that are not referenced but that still have an event (like delayed spellInfo)
-        for (auto i_events = target->m_events.GetEvents().begin(); i_events != target->m_events.GetEvents().end(); ++i_events)
-            if (SpellEvent* event = dynamic_cast<SpellEvent*>(i_events->second))
-                if (event && event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
-                    if (event->GetSpell()->getState() != SPELL_STATE_FINISHED)
-                        event->GetSpell()->cancel();
+        std::vector<Spell*> delayedSpells;
+        target->m_events.VisitEvents([this, &delayedSpells](BasicEvent* event)
+        {
+            if (SpellEvent* spellEvent = dynamic_cast<SpellEvent*>(event))
+                if (spellEvent->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
+                    delayedSpells.push_back(spellEvent->GetSpell());
+        });
+        // cancel after the visit, finish and interrupt handlers may add or reschedule events of the target
+        for (Spell* spell : delayedSpells)
+            if (spell->getState() != SPELL_STATE_FINISHED)
+                spell->cancel();
     }
 }
 
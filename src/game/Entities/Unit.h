@@ -48,6 +48,7 @@
 #include "PlayerDefines.h"
 #include "Maps/SpawnGroupDefines.h"
 
+#include <bitset>
 #include <list>
 #include <array>
 
@@ -2454,6 +2455,19 @@ class Unit : public WorldObject
 
         SpellAuraHolderMap m_spellAuraHolders;
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
+
+        // Holders that can proc at all, kept in m_spellAuraHolders order with their effective proc flags
+        // so proc events only visit holders with matching flags instead of scanning every holder
+        struct ProcHolderIndexEntry
+        {
+            ProcHolderIndexEntry(SpellAuraHolder* _holder, uint32 _procFlags) : holder(_holder), procFlags(_procFlags) {}
+            SpellAuraHolder* holder;
+            uint32 procFlags;
+        };
+        std::vector<ProcHolderIndexEntry> m_procHolderIndex;
+        uint32 m_procHolderFlags;                           // union of all proc flags in m_procHolderIndex
+        void AddToProcHolderIndex(SpellAuraHolder* holder);
+        void RemoveFromProcHolderIndex(SpellAuraHolder* holder);
         AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
         std::map<uint32, Aura*> m_classScripts;
@@ -2473,6 +2487,27 @@ class Unit : public WorldObject
         std::map<uint32, Creature*> m_creatures;
 
         AuraList m_modAuras[TOTAL_AURAS];
+        // one bit per aura type with non empty m_modAuras list, negative checks touch a single cache line
+        std::bitset<TOTAL_AURAS> m_modAuraTypes;
+        // m_modAuras mirrored in one array grouped by aura type, read by the GetTotalAura*/GetMax*Aura* aggregates
+        // without walking list nodes. The lists stay the public interface: callers remove auras while iterating them.
+        std::vector<Aura*> m_modAuraArray;
+        uint16 m_modAuraArrayEnd[TOTAL_AURAS];              // end offset of each type group in m_modAuraArray
+        struct ModAuraSpan
+        {
+            Aura* const* first;
+            Aura* const* last;
+            Aura* const* begin() const { return first; }
+            Aura* const* end() const { return last; }
+        };
+        ModAuraSpan GetModAuraSpan(AuraType type) const
+        {
+            Aura* const* data = m_modAuraArray.data();
+            return { data + (type ? m_modAuraArrayEnd[type - 1] : 0), data + m_modAuraArrayEnd[type] };
+        }
+        // the only places changing m_modAuras, keep list, bitset and array in sync
+        void LinkModAura(AuraType type, Aura* aura);
+        void UnlinkModAura(AuraType type, Aura* aura);
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
 
         WeaponDamageInfo m_weaponDamageInfo;
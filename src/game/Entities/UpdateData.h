@@ -59,7 +59,7 @@ class UpdateData
     public:
         UpdateData();
 
-        void AddOutOfRangeGUID(GuidSet& guids);
+        void AddOutOfRangeGUID(GuidHashSet const& guids);
         void AddOutOfRangeGUID(ObjectGuid const& guid);
         void AddUpdateBlock(const ByteBuffer& block);
         WorldPacket BuildPacket(size_t index, bool hasTransport = false); // Copy Elision is a thing
@@ -21,6 +21,10 @@
 
 #include "Util/Errors.h"
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 class UpdateMask
 {
     public:
@@ -34,18 +38,40 @@ class UpdateMask
 
         void SetBit(uint32 index)
         {
-            ((uint8*)mUpdateMask)[ index >> 3 ] |= 1 << (index & 0x7);
+            mUpdateMask[index >> 5] |= 1u << (index & 0x1F);
             mHasData = true;
         }
 
         void UnsetBit(uint32 index)
         {
-            ((uint8*)mUpdateMask)[ index >> 3 ] &= (0xff ^ (1 << (index & 0x7)));
+            mUpdateMask[index >> 5] &= ~(1u << (index & 0x1F));
         }
 
         bool GetBit(uint32 index) const
         {
-            return (((uint8*)mUpdateMask)[ index >> 3 ] & (1 << (index & 0x7))) != 0;
+            return (mUpdateMask[index >> 5] & (1u << (index & 0x1F))) != 0;
+        }
+
+        // whole 32 bit blocks, bit N of block B is index B * 32 + N
+        uint32 GetBlock(uint32 block) const { return mUpdateMask[block]; }
+
+        void SetBlock(uint32 block, uint32 bits)
+        {
+            mUpdateMask[block] |= bits;
+            if (bits)
+                mHasData = true;
+        }
+
+        // index of lowest set bit in a non zero block, used to walk set bits only
+        static uint32 LowestBit(uint32 bits)
+        {
+#ifdef _MSC_VER
+            unsigned long index;
+            _BitScanForward(&index, bits);
+            return uint32(index);
+#else
+            return uint32(__builtin_ctz(bits));
+#endif
         }
 
         uint32 GetBlockCount() const { return mBlocks; }
@@ -104,12 +104,73 @@ uint8 const ConditionTargetsInternal[] =
 // Starts from 4th element so that -3 will return first element.
 uint8 const* ConditionTargets = &ConditionTargetsInternal[3];
 
+// Instructions of flattened condition trees, see ConditionEntry::CompileAll
+enum ConditionOpcode : uint8
+{
+    CONDITION_OP_LEAF,                                      // result = leaf condition
+    CONDITION_OP_NOT,                                       // result = !result
+    CONDITION_OP_JUMP_IF_FALSE,                             // short circuit of CONDITION_AND
+    CONDITION_OP_JUMP_IF_TRUE,                              // short circuit of CONDITION_OR
+    CONDITION_OP_SWAP_TARGETS,                              // CONDITION_FLAG_SWAP_TARGETS of a tree node, emitted around its children
+    CONDITION_OP_RETURN,
+};
+
+struct ConditionInstruction
+{
+    ConditionOpcode op;
+    uint32 jump;                                            // absolute index in s_conditionCode
+    ConditionEntry const* leaf;
+};
+
+namespace
+{
+    // code of all compiled trees, and start index in it per tree condition entry (0 if not compiled, index 0 is a RETURN)
+    std::vector<ConditionInstruction> s_conditionCode;
+    std::vector<uint32> s_conditionProgram;
+}
+
 // Checks if player meets the condition
 bool ConditionEntry::Meets(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const
 {
     DEBUG_LOG("Condition-System: Check condition %u, type %i - called from %s with params target: %s, map %i, source %s",
               m_entry, m_condition, conditionSourceToStr[conditionSourceType], target ? target->GetGuidStr().c_str() : "<nullptr>", map ? map->GetId() : -1, source ? source->GetGuidStr().c_str() : "<nullptr>");
 
+    uint32 pc = m_condition < CONDITION_NONE && m_entry < s_conditionProgram.size() ? s_conditionProgram[m_entry] : 0;
+    if (!pc)
+        return MeetsLeaf(target, map, source, conditionSourceType);
+
+    bool result = true;
+    for (;;)
+    {
+        ConditionInstruction const& instruction = s_conditionCode[pc];
+        switch (instruction.op)
+        {
+            case CONDITION_OP_LEAF:
+                result = instruction.leaf->MeetsLeaf(target, map, source, conditionSourceType);
+                ++pc;
+                break;
+            case CONDITION_OP_NOT:
+                result = !result;
+                ++pc;
+                break;
+            case CONDITION_OP_JUMP_IF_FALSE:
+                pc = result ? pc + 1 : instruction.jump;
+                break;
+            case CONDITION_OP_JUMP_IF_TRUE:
+                pc = result ? instruction.jump : pc + 1;
+                break;
+            case CONDITION_OP_SWAP_TARGETS:
+                std::swap(source, target);
+                ++pc;
+                break;
+            case CONDITION_OP_RETURN:
+                return result;
+        }
+    }
+}
+
+bool ConditionEntry::MeetsLeaf(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const
+{
     if (m_flags & CONDITION_FLAG_SWAP_TARGETS)
         std::swap(source, target);
 
@@ -118,9 +179,27 @@ bool ConditionEntry::Meets(WorldObject const* target, Map const* map, WorldObjec
         sLog.outErrorDb("CONDITION %u type %u used with bad parameters, called from %s, used with target: %s, map %i, source %s",
             m_entry, m_condition, conditionSourceToStr[conditionSourceType], target ? target->GetGuidStr().c_str() : "<nullptr>", map ? map->GetId() : -1, source ? source->GetGuidStr().c_str() : "<nullptr>");
         return false;
-    } 
+    }
 
-    bool result = Evaluate(target, map, source, conditionSourceType);
+    bool result;
+    if (IsMapTickStable())
+    {
+        Map const* cacheMap = map;
+        if (!cacheMap && target && target->IsInWorld())
+            cacheMap = target->GetMap();
+        else if (!cacheMap && source && source->IsInWorld())
+            cacheMap = source->GetMap();
+
+        if (!cacheMap)
+            result = Evaluate(target, map, source, conditionSourceType);
+        else if (!cacheMap->GetConditionCache().Lookup(m_entry, result))
+        {
+            result = Evaluate(target, map, source, conditionSourceType);
+            cacheMap->GetConditionCache().Store(m_entry, result);
+        }
+    }
+    else
+        result = Evaluate(target, map, source, conditionSourceType);
 
     if (m_flags & CONDITION_FLAG_REVERSE_RESULT)
         result = !result;
@@ -128,6 +207,123 @@ bool ConditionEntry::Meets(WorldObject const* target, Map const* map, WorldObjec
     return result;
 }
 
+bool ConditionEntry::IsMapTickStable() const
+{
+    switch (m_condition)
+    {
+        case CONDITION_ACTIVE_GAME_EVENT:                   // game events change in world update only, between map ticks
+        case CONDITION_ACTIVE_HOLIDAY:
+        case CONDITION_COMPLETED_ENCOUNTER:                 // encounter completion sets a map world state variable
+        case CONDITION_WORLDSTATE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Appends code evaluating this condition, false if the tree references a missing entry
+bool ConditionEntry::Compile(std::vector<ConditionInstruction>& code) const
+{
+    if (m_condition >= CONDITION_NONE)
+    {
+        code.push_back({ CONDITION_OP_LEAF, 0, this });
+        return true;
+    }
+
+    if (m_flags & CONDITION_FLAG_SWAP_TARGETS)
+        code.push_back({ CONDITION_OP_SWAP_TARGETS, 0, nullptr });
+
+    // same order as Evaluate, optional third and fourth condition first
+    std::vector<uint32> children;
+    if (m_condition == CONDITION_NOT)
+        children.push_back(m_value1);
+    else
+    {
+        if (m_value3)
+            children.push_back(m_value3);
+        if (m_value4)
+            children.push_back(m_value4);
+        children.push_back(m_value1);
+        children.push_back(m_value2);
+    }
+
+    std::vector<size_t> jumps;
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        ConditionEntry const* child = sConditionStorage.LookupEntry<ConditionEntry>(children[i]);
+        if (!child || !child->Compile(code))
+            return false;
+
+        if (i + 1 < children.size())
+        {
+            jumps.push_back(code.size());
+            code.push_back({ m_condition == CONDITION_AND ? CONDITION_OP_JUMP_IF_FALSE : CONDITION_OP_JUMP_IF_TRUE, 0, nullptr });
+        }
+    }
+
+    for (size_t jump : jumps)
+        code[jump].jump = uint32(code.size());
+
+    if (m_condition == CONDITION_NOT)
+        code.push_back({ CONDITION_OP_NOT, 0, nullptr });
+
+    if (m_flags & CONDITION_FLAG_SWAP_TARGETS)
+        code.push_back({ CONDITION_OP_SWAP_TARGETS, 0, nullptr });
+
+    if (m_flags & CONDITION_FLAG_REVERSE_RESULT)
+        code.push_back({ CONDITION_OP_NOT, 0, nullptr });
+
+    return true;
+}
+
+void ConditionEntry::CompileAll()
+{
+    s_conditionCode.clear();
+    s_conditionCode.push_back({ CONDITION_OP_RETURN, 0, nullptr });
+    s_conditionProgram.assign(sConditionStorage.GetMaxEntry(), 0);
+
+    uint32 count = 0;
+    for (uint32 i = 0; i < sConditionStorage.GetMaxEntry(); ++i)
+    {
+        ConditionEntry const* condition = sConditionStorage.LookupEntry<ConditionEntry>(i);
+        if (!condition || condition->m_condition >= CONDITION_NONE)
+            continue;
+
+        size_t const start = s_conditionCode.size();
+        if (!condition->Compile(s_conditionCode))
+        {
+            // keeps the recursive evaluation
+            s_conditionCode.resize(start);
+            continue;
+        }
+
+        s_conditionCode.push_back({ CONDITION_OP_RETURN, 0, nullptr });
+        s_conditionProgram[i] = uint32(start);
+        ++count;
+    }
+
+    sLog.outString(">> Compiled %u condition trees (%u instructions)", count, uint32(s_conditionCode.size()));
+}
+
+void ConditionCache::BeginTick()
+{
+    if (++m_epoch >= 0x7FFFFFF0)
+    {
+        std::fill(m_stamps.begin(), m_stamps.end(), 0);
+        m_epoch = 1;
+    }
+    m_ownerThread = std::this_thread::get_id();
+}
+
+void ConditionCache::Store(uint32 entry, bool result)
+{
+    if (std::this_thread::get_id() != m_ownerThread)
+        return;
+    if (entry >= m_stamps.size())
+        m_stamps.resize(sConditionStorage.GetMaxEntry() > entry ? sConditionStorage.GetMaxEntry() : entry + 1, 0);
+    m_stamps[entry] = (m_epoch << 1) | uint32(result);
+}
+
 bool ConditionEntry::CheckOp(ConditionOperation op, int32 value, int32 operand)
 {
     switch (op)
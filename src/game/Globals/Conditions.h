@@ -21,8 +21,13 @@
 
 #include "Globals/SharedDefines.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 class Map;
 class WorldObject;
+struct ConditionInstruction;
 
 enum ConditionType
 {
@@ -167,9 +172,17 @@ class ConditionEntry
         bool Meets(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const;
 
         static bool CheckOp(ConditionOperation op, int32 value, int32 operand);
+
+        // Flattens CONDITION_AND, CONDITION_OR and CONDITION_NOT trees of all loaded entries, must follow every (re)load of sConditionStorage
+        static void CompileAll();
     private:
         void DisableCondition() { m_condition = CONDITION_NONE; m_flags ^= CONDITION_FLAG_REVERSE_RESULT; }
         bool CheckParamRequirements(WorldObject const* target, Map const* map, WorldObject const* source) const;
+        // Meets without logging, for single (non tree) conditions
+        bool MeetsLeaf(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const;
+        // Result only depends on state changing at most once per map tick (see ConditionCache)
+        bool IsMapTickStable() const;
+        bool Compile(std::vector<ConditionInstruction>& code) const;
         bool inline Evaluate(WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType) const;
         uint32 m_entry;                                     // entry of the condition
         ConditionType m_condition;                          // additional condition type
@@ -180,6 +193,43 @@ class ConditionEntry
         uint8 m_flags;
 };
 
+/*
+  @class ConditionCache
+  Per map memo of condition results that only depend on slowly changing state (game events, map world state
+  variables, completed encounters). Invalidated at the start of each map tick and when a world state variable
+  of the map changes. Only the thread running the map update uses it, checks from other threads (world thread
+  packet handlers, other maps) evaluate the condition uncached.
+ */
+class ConditionCache
+{
+    public:
+        ConditionCache() : m_epoch(1), m_ownerThread(std::thread::id()) {}
+
+        // map update thread, start and end of Map::Update
+        void BeginTick();
+        void EndTick() { m_ownerThread = std::thread::id(); }
+
+        // any thread
+        void Invalidate() { ++m_epoch; }
+
+        bool Lookup(uint32 entry, bool& result) const
+        {
+            if (std::this_thread::get_id() != m_ownerThread)
+                return false;
+            if (entry >= m_stamps.size() || (m_stamps[entry] >> 1) != m_epoch)
+                return false;
+            result = (m_stamps[entry] & 1) != 0;
+            return true;
+        }
+
+        void Store(uint32 entry, bool result);
+
+    private:
+        std::vector<uint32> m_stamps;                       // epoch << 1 | result, per condition entry
+        std::atomic<uint32> m_epoch;
+        std::atomic<std::thread::id> m_ownerThread;         // thread updating the map, empty outside of Map::Update
+};
+
 // Check if a player meets condition conditionId
 bool IsConditionSatisfied(uint32 conditionId, WorldObject const* target, Map const* map, WorldObject const* source, ConditionSource conditionSourceType);
 
@@ -29,7 +29,9 @@
 #include "Entities/ObjectGuid.h"
 #include "World/World.h"
 
+#include <chrono>
 #include <mutex>
+#include <thread>
 
 #define CLASS_LOCK MaNGOS::ClassLevelLockable<ObjectAccessor, std::mutex>
 INSTANTIATE_SINGLETON_2(ObjectAccessor, CLASS_LOCK);
@@ -38,23 +40,75 @@ INSTANTIATE_CLASS_MUTEX(ObjectAccessor, std::mutex);
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
 {
+#ifdef BUILD_METRICS
+    auto const start = std::chrono::steady_clock::now();
+#endif
     WriteGuard guard(i_lock);
+#ifdef BUILD_METRICS
+    m_lockWaitUs += uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+#endif
+
     m_objectMap[o->GetObjectGuid()] = o;
+    Publish();
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
+#ifdef BUILD_METRICS
+    auto const start = std::chrono::steady_clock::now();
+#endif
     WriteGuard guard(i_lock);
-    m_objectMap.erase(o->GetObjectGuid());
+#ifdef BUILD_METRICS
+    m_lockWaitUs += uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+#endif
+
+    if (m_objectMap.erase(o->GetObjectGuid()))
+        Publish();
+}
+
+template<class T>
+void HashMapHolder<T>::Publish()
+{
+    MapType const* old = m_snapshot.exchange(new MapType(m_objectMap));
+
+    // readers entering the new epoch see the new snapshot, wait for those still in the old one
+#ifdef BUILD_METRICS
+    auto const start = std::chrono::steady_clock::now();
+#endif
+    uint32 const parity = m_epoch++ & 1;
+    for (ReaderSlot& slot : m_readers)
+        while (slot.counters[parity].load() != 0)
+            std::this_thread::yield();
+#ifdef BUILD_METRICS
+    m_syncWaitUs += uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    ++m_published;
+#endif
+
+    delete old;
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    ReadGuard guard(i_lock);
-    typename MapType::iterator itr = m_objectMap.find(guid);
-    return (itr != m_objectMap.end()) ? itr->second : nullptr;
+    SnapshotGuard snapshot;
+    MapType const& map = snapshot.GetMap();
+    typename MapType::const_iterator itr = map.find(guid);
+    return (itr != map.end()) ? itr->second : nullptr;
+}
+
+template<class T>
+HashMapHolderStats HashMapHolder<T>::GetAndResetStats()
+{
+    HashMapHolderStats stats;
+    stats.published = m_published.exchange(0);
+    stats.readerRetries = m_readerRetries.exchange(0);
+    stats.lockWaitUs = m_lockWaitUs.exchange(0);
+    stats.syncWaitUs = m_syncWaitUs.exchange(0);
+
+    SnapshotGuard snapshot;
+    stats.size = uint32(snapshot.GetMap().size());
+    return stats;
 }
 
 template<class T>
@@ -113,9 +167,9 @@ Player* ObjectAccessor::FindPlayer(ObjectGuid guid, bool inWorld /*= true*/)
 
 Player* ObjectAccessor::FindPlayerByName(const char* name)
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    HashMapHolder<Player>::SnapshotGuard snapshot;
+    HashMapHolder<Player>::MapType const& m = snapshot.GetMap();
+    for (HashMapHolder<Player>::MapType::const_iterator iter = m.begin(); iter != m.end(); ++iter)
         if (iter->second->IsInWorld() && (::strcmp(name, iter->second->GetName()) == 0))
             return iter->second;
 
@@ -306,6 +360,13 @@ void ObjectAccessor::RemoveOldCorpses()
 
 template <class T> typename HashMapHolder<T>::MapType HashMapHolder<T>::m_objectMap;
 template <class T> std::mutex HashMapHolder<T>::i_lock;
+template <class T> std::atomic<typename HashMapHolder<T>::MapType const*> HashMapHolder<T>::m_snapshot(new MapType());
+template <class T> std::atomic<uint32> HashMapHolder<T>::m_epoch(0);
+template <class T> typename HashMapHolder<T>::ReaderSlot HashMapHolder<T>::m_readers[HashMapHolder<T>::READER_SLOTS] = {};
+template <class T> std::atomic<uint64> HashMapHolder<T>::m_published(0);
+template <class T> std::atomic<uint64> HashMapHolder<T>::m_readerRetries(0);
+template <class T> std::atomic<uint64> HashMapHolder<T>::m_lockWaitUs(0);
+template <class T> std::atomic<uint64> HashMapHolder<T>::m_syncWaitUs(0);
 
 /// Global definitions for the hashmap storage
 
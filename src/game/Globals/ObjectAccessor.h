@@ -31,39 +31,124 @@
 #include "Entities/Player.h"
 #include "Entities/Corpse.h"
 
+#include <atomic>
 #include <mutex>
 
 class Unit;
 class WorldObject;
 class Map;
 
+struct HashMapHolderStats
+{
+    uint64 published;                                       // snapshots published by Insert/Remove
+    uint64 readerRetries;                                   // lock free reads restarted because the epoch flipped
+    uint64 lockWaitUs;                                      // writers waiting for other writers or lock based iteration
+    uint64 syncWaitUs;                                      // writers waiting for readers of the previous snapshot
+    uint32 size;
+};
+
+/*
+  Objects are registered in a master map guarded by i_lock, which is also used by the lock based iteration
+  of GetContainer(). Each Insert/Remove publishes an immutable copy of the master map, so a registration
+  costs a copy of the whole map: fine for players and corpses, which change at login/logout/death rate
+  while lookups happen per packet and per spell. Find and SnapshotGuard read the latest copy without
+  locking: readers announce themselves in the counter of the current epoch in the reader slot of their
+  thread, the writer flips the epoch after publishing and waits for the counters of the previous epoch in
+  all slots to drop to zero before deleting the replaced copy. Slots are cache line sized, so readers of
+  different threads do not contend. A SnapshotGuard must not be held over code that can register or
+  unregister objects.
+ */
 template <class T>
 class HashMapHolder
 {
     public:
 
-        typedef std::unordered_map<ObjectGuid, T*>   MapType;
+        typedef MaNGOS::OpenHashMap<ObjectGuid, T*>  MapType;
         typedef std::mutex LockType;
         typedef std::lock_guard<std::mutex> ReadGuard;
         typedef std::lock_guard<std::mutex> WriteGuard;
 
+        class SnapshotGuard
+        {
+            public:
+                SnapshotGuard() : m_counters(m_readers[GetReaderSlot()].counters)
+                {
+                    for (;;)
+                    {
+                        uint32 const epoch = m_epoch.load();
+                        m_parity = epoch & 1;
+                        ++m_counters[m_parity];
+                        if (m_epoch.load() == epoch)
+                            break;
+
+                        // writer flipped meanwhile and may already wait only for the new parity
+                        --m_counters[m_parity];
+#ifdef BUILD_METRICS
+                        m_readerRetries.fetch_add(1, std::memory_order_relaxed);
+#endif
+                    }
+                    m_map = m_snapshot.load();
+                }
+                ~SnapshotGuard() { --m_counters[m_parity]; }
+
+                MapType const& GetMap() const { return *m_map; }
+
+            private:
+                SnapshotGuard(SnapshotGuard const&);
+                SnapshotGuard& operator=(SnapshotGuard const&);
+
+                std::atomic<uint32>* m_counters;
+                uint32 m_parity;
+                MapType const* m_map;
+        };
+
         static void Insert(T* o);
 
         static void Remove(T* o);
 
+        // lock free
         static T* Find(ObjectGuid guid);
 
         static MapType& GetContainer();
 
         static LockType& GetLock();
 
+        static HashMapHolderStats GetAndResetStats();
+
     private:
 
         // Non instanceable only static
         HashMapHolder() {}
 
+        // i_lock must be held
+        static void Publish();
+
+        static uint32 const READER_SLOTS = 32;
+
+        // reader counters per epoch parity, threads are spread over the slots round robin
+        struct alignas(64) ReaderSlot
+        {
+            std::atomic<uint32> counters[2];
+        };
+
+        static uint32 GetReaderSlot()
+        {
+            static std::atomic<uint32> nextSlot(0);
+            static thread_local uint32 const slot = nextSlot.fetch_add(1, std::memory_order_relaxed) % READER_SLOTS;
+            return slot;
+        }
+
         static LockType i_lock;
         static MapType  m_objectMap;
+
+        static std::atomic<MapType const*> m_snapshot;
+        static std::atomic<uint32> m_epoch;
+        static ReaderSlot m_readers[READER_SLOTS];
+
+        static std::atomic<uint64> m_published;
+        static std::atomic<uint64> m_readerRetries;
+        static std::atomic<uint64> m_lockWaitUs;
+        static std::atomic<uint64> m_syncWaitUs;
 };
 
 class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLevelLockable<ObjectAccessor, std::mutex> >
@@ -76,7 +161,7 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
         ObjectAccessor& operator=(const ObjectAccessor&);
 
     public:
-        typedef std::unordered_map<ObjectGuid, Corpse*> Player2CorpsesMapType;
+        typedef MaNGOS::OpenHashMap<ObjectGuid, Corpse*> Player2CorpsesMapType;
 
         // Search player at any map in world and other objects at same map with `obj`
         // Note: recommended use Map::GetUnit version if player also expected at same map only
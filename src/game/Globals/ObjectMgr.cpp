@@ -1934,8 +1934,10 @@ void ObjectMgr::AddCreatureToGrid(uint32 guid, CreatureData const* data)
     CellPair cell_pair = MaNGOS::ComputeCellPair(data->posX, data->posY);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
+    std::lock_guard<std::mutex> guard(m_mapSpawnImageMutex);
     CellObjectGuids& cell_guids = mMapObjectGuids[data->mapid][cell_id];
     cell_guids.creatures.insert(guid);
+    UpdateCellSpawnImage(data->mapid, cell_id);
 }
 
 void ObjectMgr::RemoveCreatureFromGrid(uint32 guid, CreatureData const* data)
@@ -1943,8 +1945,10 @@ void ObjectMgr::RemoveCreatureFromGrid(uint32 guid, CreatureData const* data)
     CellPair cell_pair = MaNGOS::ComputeCellPair(data->posX, data->posY);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
+    std::lock_guard<std::mutex> guard(m_mapSpawnImageMutex);
     CellObjectGuids& cell_guids = mMapObjectGuids[data->mapid][cell_id];
     cell_guids.creatures.erase(guid);
+    UpdateCellSpawnImage(data->mapid, cell_id);
 }
 
 void ObjectMgr::LoadGameObjects()
@@ -2208,8 +2212,10 @@ void ObjectMgr::AddGameobjectToGrid(uint32 guid, GameObjectData const* data)
     CellPair cell_pair = MaNGOS::ComputeCellPair(data->posX, data->posY);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
+    std::lock_guard<std::mutex> guard(m_mapSpawnImageMutex);
     CellObjectGuids& cell_guids = mMapObjectGuids[data->mapid][cell_id];
     cell_guids.gameobjects.insert(guid);
+    UpdateCellSpawnImage(data->mapid, cell_id);
 }
 
 void ObjectMgr::RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data)
@@ -2217,8 +2223,66 @@ void ObjectMgr::RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data
     CellPair cell_pair = MaNGOS::ComputeCellPair(data->posX, data->posY);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
+    std::lock_guard<std::mutex> guard(m_mapSpawnImageMutex);
     CellObjectGuids& cell_guids = mMapObjectGuids[data->mapid][cell_id];
     cell_guids.gameobjects.erase(guid);
+    UpdateCellSpawnImage(data->mapid, cell_id);
+}
+
+std::shared_ptr<CellSpawnImage const> ObjectMgr::BuildCellSpawnImage(CellObjectGuids const& cellGuids) const
+{
+    if (cellGuids.creatures.empty() && cellGuids.gameobjects.empty())
+        return nullptr;
+
+    std::shared_ptr<CellSpawnImage> cellImage = std::make_shared<CellSpawnImage>();
+
+    cellImage->creatures.reserve(cellGuids.creatures.size());
+    for (uint32 dbGuid : cellGuids.creatures)
+        if (CreatureData const* data = GetCreatureData(dbGuid))
+            cellImage->creatures.push_back({ dbGuid, *data, data->id ? GetCreatureTemplate(data->id) : nullptr });
+
+    cellImage->gameobjects.reserve(cellGuids.gameobjects.size());
+    for (uint32 dbGuid : cellGuids.gameobjects)
+        if (GameObjectData const* data = GetGOData(dbGuid))
+            cellImage->gameobjects.push_back({ dbGuid, *data, data->id && !GetAllRandomGameObjectEntries(dbGuid) ? GetGameObjectInfo(data->id) : nullptr });
+
+    return cellImage;
+}
+
+void ObjectMgr::UpdateCellSpawnImage(uint32 mapId, uint32 cellId)
+{
+    auto imageItr = m_mapSpawnImages.find(mapId);
+    if (imageItr == m_mapSpawnImages.end())
+        return;                                             // not built yet
+
+    // copy on write of the cell pointers, images held by loading grids stay valid
+    std::shared_ptr<MapSpawnImage> image = std::make_shared<MapSpawnImage>(*imageItr->second);
+    if (std::shared_ptr<CellSpawnImage const> cellImage = BuildCellSpawnImage(mMapObjectGuids[mapId][cellId]))
+        (*image)[cellId] = cellImage;
+    else
+        image->erase(cellId);
+
+    imageItr->second = image;
+}
+
+std::shared_ptr<MapSpawnImage const> ObjectMgr::GetMapSpawnImage(uint32 mapId)
+{
+    std::lock_guard<std::mutex> guard(m_mapSpawnImageMutex);
+
+    auto imageItr = m_mapSpawnImages.find(mapId);
+    if (imageItr != m_mapSpawnImages.end())
+        return imageItr->second;
+
+    std::shared_ptr<MapSpawnImage> image = std::make_shared<MapSpawnImage>();
+
+    MapObjectGuids::const_iterator mapItr = mMapObjectGuids.find(mapId);
+    if (mapItr != mMapObjectGuids.end())
+        for (auto const& cellData : mapItr->second)
+            if (std::shared_ptr<CellSpawnImage const> cellImage = BuildCellSpawnImage(cellData.second))
+                image->emplace(cellData.first, cellImage);
+
+    m_mapSpawnImages.emplace(mapId, image);
+    return image;
 }
 
 // Get player map id of offline player. Return -1 if not found!
@@ -5413,6 +5477,8 @@ void ObjectMgr::LoadConditions()
         }
     }
 
+    ConditionEntry::CompileAll();
+
     for (auto& mQuestTemplate : mQuestTemplates) // needs to be checked after loading conditions
     {
         Quest* qinfo = mQuestTemplate.second;
@@ -7676,15 +7742,35 @@ void ObjectMgr::DeleteGOData(uint32 guid)
 void ObjectMgr::AddCorpseCellData(uint32 mapid, uint32 cellid, uint32 player_guid, uint32 instance)
 {
     // corpses are always added to spawn mode 0 and they are spawned by their instance id
-    CellObjectGuids& cell_guids = mMapObjectGuids[mapid][cellid];
-    cell_guids.corpses[player_guid] = instance;
+    std::lock_guard<std::mutex> guard(m_corpseCellMutex);
+    m_mapCorpseCells[mapid][cellid][player_guid] = instance;
 }
 
 void ObjectMgr::DeleteCorpseCellData(uint32 mapid, uint32 cellid, uint32 player_guid)
 {
-    // corpses are always added to spawn mode 0 and they are spawned by their instance id
-    CellObjectGuids& cell_guids = mMapObjectGuids[mapid][cellid];
-    cell_guids.corpses.erase(player_guid);
+    std::lock_guard<std::mutex> guard(m_corpseCellMutex);
+    auto mapItr = m_mapCorpseCells.find(mapid);
+    if (mapItr == m_mapCorpseCells.end())
+        return;
+
+    auto cellItr = mapItr->second.find(cellid);
+    if (cellItr == mapItr->second.end())
+        return;
+
+    cellItr->second.erase(player_guid);
+    if (cellItr->second.empty())
+        mapItr->second.erase(cellItr);
+}
+
+CellCorpseSet ObjectMgr::GetCellCorpses(uint32 mapid, uint32 cell_id) const
+{
+    std::lock_guard<std::mutex> guard(m_corpseCellMutex);
+    auto mapItr = m_mapCorpseCells.find(mapid);
+    if (mapItr == m_mapCorpseCells.end())
+        return CellCorpseSet();
+
+    auto cellItr = mapItr->second.find(cell_id);
+    return cellItr != mapItr->second.end() ? cellItr->second : CellCorpseSet();
 }
 
 void ObjectMgr::LoadQuestRelationsHelper(QuestRelationsMap& map, char const* table)
@@ -37,6 +37,7 @@
 #include <map>
 #include <climits>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <optional>
 
@@ -136,11 +137,36 @@ struct CellObjectGuids
 {
     CellGuidSet creatures;
     CellGuidSet gameobjects;
-    CellCorpseSet corpses;
 };
 typedef std::unordered_map < uint32/*cell_id*/, CellObjectGuids > CellObjectGuidsMap;
+typedef std::unordered_map < uint32/*cell_id*/, CellCorpseSet > CellCorpsesMap;
 typedef std::unordered_map < uint32/*mapid*/, CellObjectGuidsMap > MapObjectGuids;
 
+// read-only image of static spawns of a map, shared by all its instances
+// entries keep db guid order of CellGuidSet and hold a copy of the spawn data, so an image still held by a
+// loading grid stays valid when the spawn is deleted from ObjectMgr meanwhile
+struct CreatureSpawnImage
+{
+    uint32 dbGuid;
+    CreatureData data;
+    CreatureInfo const* cinfo;                              // template of data.id, nullptr if the entry is chosen at load
+};
+
+struct GameObjectSpawnImage
+{
+    uint32 dbGuid;
+    GameObjectData data;
+    GameObjectInfo const* goinfo;                           // template of data.id, nullptr if the entry is chosen at load
+};
+
+struct CellSpawnImage
+{
+    std::vector<CreatureSpawnImage> creatures;
+    std::vector<GameObjectSpawnImage> gameobjects;
+};
+// cells are replaced one by one on spawn changes, readers keep the image they took
+typedef std::unordered_map < uint32/*cell_id*/, std::shared_ptr<CellSpawnImage const> > MapSpawnImage;
+
 // mangos string ranges
 #define MIN_MANGOS_STRING_ID           1                    // 'mangos_string'
 #define MAX_MANGOS_STRING_ID           2000000000
@@ -1007,11 +1033,12 @@ class ObjectMgr
         int GetStorageLocaleIndexFor(LocaleConstant loc);
         int GetOrNewStorageLocaleIndexFor(LocaleConstant loc);
 
-        // global grid objects state (static DB spawns, global spawn mods from gameevent system)
-        CellObjectGuids const& GetCellObjectGuids(uint16 mapid, uint32 cell_id)
-        {
-            return mMapObjectGuids[mapid][cell_id];
-        }
+        // static creature and gameobject spawns of a map resolved to their data, shared by all instances of the map
+        // built at first request, changes of global grid objects state replace the affected cell only
+        std::shared_ptr<MapSpawnImage const> GetMapSpawnImage(uint32 mapId);
+
+        // copy of the corpses listed in a cell, safe to call from map threads
+        CellCorpseSet GetCellCorpses(uint32 mapid, uint32 cell_id) const;
 
         // modifiers for global grid objects state (static DB spawns, global spawn mods from gameevent system)
         // Don't must be used for modify instance specific spawn state modifications
@@ -1336,7 +1363,15 @@ class ObjectMgr
         // Array to store creature stats, Max creature level + 1 (for data alignement with in game level)
         CreatureClassLvlStats m_creatureClassLvlStats[DEFAULT_MAX_CREATURE_LEVEL + 1][MAX_CREATURE_CLASS];
 
+        // m_mapSpawnImageMutex held
+        std::shared_ptr<CellSpawnImage const> BuildCellSpawnImage(CellObjectGuids const& cellGuids) const;
+        void UpdateCellSpawnImage(uint32 mapId, uint32 cellId);
+
         MapObjectGuids mMapObjectGuids;
+        std::unordered_map<uint32, std::shared_ptr<MapSpawnImage const>> m_mapSpawnImages;
+        std::mutex m_mapSpawnImageMutex;                    // guards m_mapSpawnImages and mMapObjectGuids
+        std::unordered_map<uint32/*mapid*/, CellCorpsesMap> m_mapCorpseCells;
+        mutable std::mutex m_corpseCellMutex;               // guards m_mapCorpseCells, written by ObjectAccessor and read at grid load
         ActiveObjectGuidsOnMap m_activeCreatures;
         ActiveObjectGuidsOnMap m_activeGameObjects;
         CreatureSpawnTemplateMap m_creatureSpawnTemplateMap;
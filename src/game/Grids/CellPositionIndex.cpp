@@ -0,0 +1,104 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Grids/CellPositionIndex.h"
+#include "Entities/Object.h"
+
+uint32 const CellPositionIndex::WORLD_TYPE_ORDER[3] = { 1 << TYPEID_PLAYER, 1 << TYPEID_UNIT, 1 << TYPEID_CORPSE };
+uint32 const CellPositionIndex::GRID_TYPE_ORDER[4] = { 1 << TYPEID_GAMEOBJECT, 1 << TYPEID_UNIT, 1 << TYPEID_DYNAMICOBJECT, 1 << TYPEID_CORPSE };
+
+CellPositionIndex::~CellPositionIndex()
+{
+    // objects still listed outlive the cell (corpses kept by ObjectAccessor at grid unload)
+    for (WorldObject* obj : m_objects)
+        if (obj)
+            obj->m_positionIndex = nullptr;
+}
+
+void CellPositionIndex::Insert(WorldObject* obj, bool worldObject)
+{
+    // grid reference relink without remove, move the entry
+    if (obj->m_positionIndex)
+        obj->m_positionIndex->Remove(obj);
+
+    obj->m_positionIndex = this;
+    obj->m_positionIndexSlot = uint32(m_objects.size());
+
+    m_x.push_back(obj->GetPositionX());
+    m_y.push_back(obj->GetPositionY());
+    m_radius.push_back(obj->GetPositionIndexRadius());
+    m_typeBits.push_back((uint32(1) << obj->GetTypeId()) | (worldObject ? WORLD_CONTAINER_BIT : 0));
+    m_objects.push_back(obj);
+}
+
+void CellPositionIndex::Remove(WorldObject* obj)
+{
+    if (obj->m_positionIndex != this)
+        return;
+
+    uint32 const slot = obj->m_positionIndexSlot;
+    obj->m_positionIndex = nullptr;
+    obj->m_positionIndexSlot = 0;
+
+    // leave a hole, moving the last entry in would change the visit order
+    m_typeBits[slot] = 0;
+    m_objects[slot] = nullptr;
+    ++m_holes;
+
+    // trailing holes are dropped right away
+    while (!m_objects.empty() && !m_objects.back())
+    {
+        m_x.pop_back();
+        m_y.pop_back();
+        m_radius.pop_back();
+        m_typeBits.pop_back();
+        m_objects.pop_back();
+        --m_holes;
+    }
+
+    if (m_holes * 2 > m_objects.size())
+        Compact();
+}
+
+void CellPositionIndex::Compact()
+{
+    uint32 used = 0;
+    for (uint32 slot = 0; slot < m_objects.size(); ++slot)
+    {
+        if (!m_objects[slot])
+            continue;
+
+        if (used != slot)
+        {
+            m_x[used] = m_x[slot];
+            m_y[used] = m_y[slot];
+            m_radius[used] = m_radius[slot];
+            m_typeBits[used] = m_typeBits[slot];
+            m_objects[used] = m_objects[slot];
+            m_objects[used]->m_positionIndexSlot = used;
+        }
+        ++used;
+    }
+
+    m_x.resize(used);
+    m_y.resize(used);
+    m_radius.resize(used);
+    m_typeBits.resize(used);
+    m_objects.resize(used);
+    m_holes = 0;
+}
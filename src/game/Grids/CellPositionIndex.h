@@ -0,0 +1,194 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_CELLPOSITIONINDEX_H
+#define MANGOS_CELLPOSITIONINDEX_H
+
+#include "Common.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+class WorldObject;
+class Camera;
+
+/*
+  @class CellPositionIndex
+  Position index policy of a grid cell: x, y, size (larger of combat reach and bounding radius) and type
+  of every world object of the cell stored as parallel arrays (structure of arrays), kept in sync on add,
+  remove and Relocate(). Range searches (searchers whose check exposes GetSearchRange()) filter the arrays
+  in one linear, vectorizable pass and only touch the objects in reach, instead of following the cell
+  object lists. Objects are visited in the order the cell lists would give (types in container order,
+  newest first), so first and last match searchers find the same object as with the lists. Removed
+  entries are left as holes and compacted in order once they make up half of the arrays.
+ */
+class CellPositionIndex
+{
+    public:
+        // bit of m_typeBits set for objects stored in the world object list of the cell
+        static uint32 const WORLD_CONTAINER_BIT = 0x80000000;
+
+        CellPositionIndex() {}
+        ~CellPositionIndex();
+
+        CellPositionIndex(CellPositionIndex const&) = delete;
+        CellPositionIndex& operator=(CellPositionIndex const&) = delete;
+
+        void Insert(WorldObject* obj, bool worldObject);
+        void Insert(Camera* /*camera*/, bool /*worldObject*/) {}
+        void Remove(WorldObject* obj);
+        void Remove(Camera* /*camera*/) {}
+
+        // called by WorldObject on position or bounding radius change
+        void Update(uint32 slot, float x, float y, float radius)
+        {
+            m_x[slot] = x;
+            m_y[slot] = y;
+            m_radius[slot] = radius;
+        }
+
+        uint32 Size() const { return uint32(m_objects.size()) - m_holes; }
+
+        // Grid hook, let searchers with range aware checks use the index instead of the object lists
+        template<class VISITOR>
+        bool Visit(VISITOR& visitor, bool worldObjects) const;
+
+        // calls f(object) for objects of typeBits (1 << TypeID) of one list whose size circle reaches range around x, y
+        // f returns false to stop the search
+        template<class F>
+        void VisitInRange(float x, float y, float range, uint32 typeBits, bool worldObjects, F&& f) const;
+
+        // VisitInRange around focus object of a check, if the check is range aware, return false otherwise
+        template<class Check, class F>
+        bool VisitInCheckRange(Check const& check, uint32 typeBits, bool worldObjects, F&& f) const;
+
+    private:
+        // filter block size, matches are collected per block before objects are touched
+        static uint32 const FILTER_BLOCK = 64;
+
+        // types of the world and grid object containers (AllWorldObjectTypes, AllGridObjectTypes) in visit order
+        static uint32 const WORLD_TYPE_ORDER[3];
+        static uint32 const GRID_TYPE_ORDER[4];
+
+        // typeBits: bit of one type and the container bit
+        template<class F>
+        bool VisitTypeInRange(float x, float y, float range, uint32 typeBits, F& f) const;
+
+        void Compact();
+
+        uint32 m_holes = 0;
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+        std::vector<float> m_radius;
+        std::vector<uint32> m_typeBits;
+        std::vector<WorldObject*> m_objects;
+};
+
+namespace MaNGOS
+{
+    // checks with "float GetSearchRange() const" guarantee to reject anything out of that 2d range
+    // around their focus object (plus GetPositionIndexRadius() of both objects)
+    template<class Check, class = void>
+    struct HasSearchRange : std::false_type {};
+
+    template<class Check>
+    struct HasSearchRange<Check, decltype(void(std::declval<Check const&>().GetSearchRange()))> : std::true_type {};
+
+    // searchers able to use CellPositionIndex implement "bool VisitIndexed(CellPositionIndex const&, bool worldObjects)"
+    template<class VISITOR, class = void>
+    struct HasIndexedVisit : std::false_type {};
+
+    template<class VISITOR>
+    struct HasIndexedVisit<VISITOR, decltype(void(std::declval<VISITOR&>().VisitIndexed(std::declval<CellPositionIndex const&>(), true)))> : std::true_type {};
+}
+
+template<class VISITOR>
+inline bool CellPositionIndex::Visit(VISITOR& visitor, bool worldObjects) const
+{
+    if constexpr (MaNGOS::HasIndexedVisit<VISITOR>::value)
+        return visitor.VisitIndexed(*this, worldObjects);
+    else
+        return false;
+}
+
+template<class F>
+inline bool CellPositionIndex::VisitTypeInRange(float x, float y, float range, uint32 typeBits, F& f) const
+{
+    uint32 const count = uint32(m_objects.size());
+    uint32 const mask = typeBits | WORLD_CONTAINER_BIT;
+    uint8 matches[FILTER_BLOCK];
+
+    // newest entries first, as the cell lists (GridReference links at the list head)
+    for (uint32 end = count; end > 0;)
+    {
+        uint32 const blockSize = std::min(FILTER_BLOCK, end);
+        uint32 const base = end - blockSize;
+        end = base;
+
+        float const* posX = &m_x[base];
+        float const* posY = &m_y[base];
+        float const* radius = &m_radius[base];
+        uint32 const* types = &m_typeBits[base];
+
+        // branch free pass over contiguous arrays, left for the compiler to vectorize
+        for (uint32 i = 0; i < blockSize; ++i)
+        {
+            float const dx = posX[i] - x;
+            float const dy = posY[i] - y;
+            float const reach = range + radius[i];
+            matches[i] = uint8(dx * dx + dy * dy <= reach * reach) & uint8((types[i] & mask) == typeBits);
+        }
+
+        for (uint32 i = blockSize; i > 0; --i)
+            if (matches[i - 1] && !f(m_objects[base + i - 1]))
+                return false;
+    }
+    return true;
+}
+
+template<class F>
+inline void CellPositionIndex::VisitInRange(float x, float y, float range, uint32 typeBits, bool worldObjects, F&& f) const
+{
+    if (!Size())
+        return;
+
+    uint32 const* order = worldObjects ? WORLD_TYPE_ORDER : GRID_TYPE_ORDER;
+    uint32 const orderSize = worldObjects ? 3 : 4;
+    uint32 const containerBit = worldObjects ? WORLD_CONTAINER_BIT : 0;
+
+    // one pass per type, holes have no type bits and never match
+    for (uint32 i = 0; i < orderSize; ++i)
+        if ((typeBits & order[i]) && !VisitTypeInRange(x, y, range, order[i] | containerBit, f))
+            return;
+}
+
+template<class Check, class F>
+inline bool CellPositionIndex::VisitInCheckRange(Check const& check, uint32 typeBits, bool worldObjects, F&& f) const
+{
+    if constexpr (MaNGOS::HasSearchRange<Check>::value)
+    {
+        auto const& focus = check.GetFocusObject();
+        VisitInRange(focus.GetPositionX(), focus.GetPositionY(), check.GetSearchRange() + focus.GetPositionIndexRadius(), typeBits, worldObjects, std::forward<F>(f));
+        return true;
+    }
+    else
+        return false;
+}
+
+#endif
@@ -64,9 +64,9 @@ void VisibleNotifier::Notify()
     }
 
     // Far objects update on player notify
-    for (GuidSet::iterator itr = i_clientGUIDs.begin(); itr != i_clientGUIDs.end();)
+    for (GuidHashSet::iterator itr = i_clientGUIDs.begin(); itr != i_clientGUIDs.end();)
     {
-        GuidSet::iterator current = itr++;
+        GuidHashSet::iterator current = itr++;
         if (WorldObject* obj = player.GetMap()->GetWorldObject(*current))
         {
             if (!obj->GetVisibilityData().IsVisibilityOverridden())
@@ -79,7 +79,7 @@ void VisibleNotifier::Notify()
 
     // generate outOfRange for not iterate objects
     i_data.AddOutOfRangeGUID(i_clientGUIDs);
-    for (GuidSet::iterator itr = i_clientGUIDs.begin(); itr != i_clientGUIDs.end(); ++itr)
+    for (GuidHashSet::iterator itr = i_clientGUIDs.begin(); itr != i_clientGUIDs.end(); ++itr)
     {
         if (WorldObject* target = player.GetMap()->GetWorldObject(*itr))
         {
@@ -98,10 +98,13 @@ void VisibleNotifier::Notify()
     if (i_data.HasData())
     {
         // send create/outofrange packet to player (except player create updates that already sent using SendUpdateToPlayer)
-        for (size_t i = 0; i < i_data.GetPacketCount(); ++i)
+        if (player.GetSession()->WantsOpcode(SMSG_UPDATE_OBJECT))
         {
-            WorldPacket packet = i_data.BuildPacket(i);
-            player.GetSession()->SendPacket(packet);
+            for (size_t i = 0; i < i_data.GetPacketCount(); ++i)
+            {
+                WorldPacket packet = i_data.BuildPacket(i);
+                player.GetSession()->SendPacket(packet);
+            }
         }
 
         // send out of range to other players if need
@@ -117,6 +120,36 @@ void VisibleNotifier::Notify()
     }
 }
 
+void BroadcastReceivers::Send(WorldPacket const& packet) const
+{
+    // bot sessions not subscribed to the opcode are skipped, the body is only built for real receivers
+    WorldSession* first = nullptr;
+    size_t receivers = 0;
+    for (WorldSession* session : m_sessions)
+    {
+        if (!session->WantsOpcode(packet.GetOpcode()))
+            continue;
+        if (!first)
+            first = session;
+        ++receivers;
+    }
+
+    if (!receivers)
+        return;
+
+    if (receivers == 1)
+    {
+        first->SendPacket(packet);
+        return;
+    }
+
+    char const* data = packet.empty() ? nullptr : reinterpret_cast<char const*>(packet.contents());
+    SharedPacketBody body = std::make_shared<std::vector<char> const>(data, data + packet.size());
+    for (WorldSession* session : m_sessions)
+        if (session->WantsOpcode(packet.GetOpcode()))
+            session->SendSharedPacket(packet, body);
+}
+
 void MessageDeliverer::Visit(CameraMapType& m)
 {
     for (auto& iter : m)
@@ -126,7 +159,7 @@ void MessageDeliverer::Visit(CameraMapType& m)
         if (i_toSelf || owner != &i_player)
         {
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                i_receivers.Add(session);
         }
     }
 }
@@ -141,7 +174,7 @@ void MessageDelivererExcept::Visit(CameraMapType& m)
             continue;
 
         if (WorldSession* session = owner->GetSession())
-            session->SendPacket(i_message);
+            i_receivers.Add(session);
     }
 }
 
@@ -150,7 +183,7 @@ void ObjectMessageDeliverer::Visit(CameraMapType& m)
     for (auto& iter : m)
     {
         if (WorldSession* session = iter.getSource()->GetOwner()->GetSession())
-            session->SendPacket(i_message);
+            i_receivers.Add(session);
     }
 }
 
@@ -165,7 +198,7 @@ void MessageDistDeliverer::Visit(CameraMapType& m)
                 (!i_dist || iter.getSource()->GetBody()->IsWithinDist(&i_player, i_dist)))
         {
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                i_receivers.Add(session);
         }
     }
 }
@@ -177,7 +210,7 @@ void ObjectMessageDistDeliverer::Visit(CameraMapType& m)
         if (!i_dist || iter.getSource()->GetBody()->IsWithinDist(&i_object, i_dist))
         {
             if (WorldSession* session = iter.getSource()->GetOwner()->GetSession())
-                session->SendPacket(i_message);
+                i_receivers.Add(session);
         }
     }
 }
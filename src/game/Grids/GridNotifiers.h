@@ -36,7 +36,7 @@ namespace MaNGOS
     {
         Camera& i_camera;
         UpdateData i_data;
-        GuidSet i_clientGUIDs;
+        GuidHashSet i_clientGUIDs;
         WorldObjectSet i_visibleNow;
 
         explicit VisibleNotifier(Camera& c) : i_camera(c), i_clientGUIDs(c.GetOwner()->GetClientGuids()) {}
@@ -58,34 +58,53 @@ namespace MaNGOS
         GuidSet m_unvisitedGuids;
     };
 
+    // Receivers of a broadcast collected while visiting cells, the packet body is then built
+    // once and shared by the send queues of all receivers instead of being copied per receiver
+    class BroadcastReceivers
+    {
+        public:
+            void Add(WorldSession* session) { m_sessions.push_back(session); }
+            void Send(WorldPacket const& packet) const;
+
+        private:
+            std::vector<WorldSession*> m_sessions;
+    };
+
+    // Message deliverers only collect receivers, Deliver() must be called after the visit
     struct MessageDeliverer
     {
         Player const& i_player;
         WorldPacket const& i_message;
         bool i_toSelf;
+        BroadcastReceivers i_receivers;
         MessageDeliverer(Player const& pl, WorldPacket const& msg, bool to_self) : i_player(pl), i_message(msg), i_toSelf(to_self) {}
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+        void Deliver() const { i_receivers.Send(i_message); }
     };
 
     struct MessageDelivererExcept
     {
         WorldPacket const&  i_message;
         Player const* i_skipped_receiver;
+        BroadcastReceivers i_receivers;
 
         MessageDelivererExcept(WorldPacket const& msg, Player const* skipped)
             : i_message(msg), i_skipped_receiver(skipped) {}
 
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+        void Deliver() const { i_receivers.Send(i_message); }
     };
 
     struct ObjectMessageDeliverer
     {
         WorldPacket const& i_message;
+        BroadcastReceivers i_receivers;
         explicit ObjectMessageDeliverer(WorldPacket const& msg) : i_message(msg) {}
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+        void Deliver() const { i_receivers.Send(i_message); }
     };
 
     struct MessageDistDeliverer
@@ -95,11 +114,13 @@ namespace MaNGOS
         bool i_toSelf;
         bool i_ownTeamOnly;
         float i_dist;
+        BroadcastReceivers i_receivers;
 
         MessageDistDeliverer(Player const& pl, WorldPacket const& msg, float dist, bool to_self, bool ownTeamOnly)
             : i_player(pl), i_message(msg), i_toSelf(to_self), i_ownTeamOnly(ownTeamOnly), i_dist(dist) {}
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+        void Deliver() const { i_receivers.Send(i_message); }
     };
 
     struct ObjectMessageDistDeliverer
@@ -107,9 +128,11 @@ namespace MaNGOS
         WorldObject const& i_object;
         WorldPacket const& i_message;
         float i_dist;
+        BroadcastReceivers i_receivers;
         ObjectMessageDistDeliverer(WorldObject const& obj, WorldPacket const& msg, float dist) : i_object(obj), i_message(msg), i_dist(dist) {}
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+        void Deliver() const { i_receivers.Send(i_message); }
     };
 
     struct ObjectUpdater
@@ -343,6 +366,8 @@ namespace MaNGOS
 
         UnitSearcher(Unit*& result, Check& check) : i_object(result), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
@@ -358,6 +383,8 @@ namespace MaNGOS
 
         UnitLastSearcher(Unit*& result, Check& check) : i_object(result), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
@@ -373,6 +400,8 @@ namespace MaNGOS
 
         UnitListSearcher(UnitList& objects, Check& check) : i_objects(objects), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
 
@@ -389,6 +418,8 @@ namespace MaNGOS
 
         CreatureSearcher(Creature*& result, Check& check) : i_object(result), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(CreatureMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
@@ -403,6 +434,8 @@ namespace MaNGOS
 
         CreatureLastSearcher(Creature*& result, Check& check) : i_object(result), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(CreatureMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
@@ -416,6 +449,8 @@ namespace MaNGOS
 
         CreatureListSearcher(CreatureList& objects, Check& check) : i_objects(objects), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(CreatureMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
@@ -447,6 +482,8 @@ namespace MaNGOS
 
         PlayerSearcher(Player*& result, Check& check) : i_object(result), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(PlayerMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
@@ -461,6 +498,8 @@ namespace MaNGOS
         PlayerListSearcher(PlayerList& objects, Check& check)
             : i_objects(objects), i_check(check) {}
 
+        bool VisitIndexed(CellPositionIndex const& index, bool worldObjects);
+
         void Visit(PlayerMapType& m);
 
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
@@ -827,6 +866,7 @@ namespace MaNGOS
         public:
             MostHPMissingInRangeCheck(Unit const* obj, float range, float hp, bool onlyInCombat, bool targetSelf) : i_obj(obj), i_range(range), i_hp(hp), i_onlyInCombat(onlyInCombat), i_targetSelf(targetSelf) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 if (!u->IsAlive() || (i_onlyInCombat && !u->IsInCombat()))
@@ -858,6 +898,7 @@ namespace MaNGOS
         public:
             MostHPPercentMissingInRangeCheck(Unit const* obj, float range, float hp, bool onlyInCombat, bool targetSelf) : i_obj(obj), i_range(range), i_hp(hp), i_onlyInCombat(onlyInCombat), i_targetSelf(targetSelf) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 if (!u->IsAlive() || (i_onlyInCombat && !u->IsInCombat()))
@@ -912,6 +953,7 @@ namespace MaNGOS
             FriendlyEligibleDispelInRangeCheck(Unit const* obj, float range, uint32 dispelMask, uint32 mechanicMask, bool self) :
                 i_obj(obj), i_range(range), m_dispelMask(dispelMask), m_mechanicMask(mechanicMask), m_self(self) {}
             Unit const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 if (!u->IsAlive() || !u->IsInCombat() || !i_obj->CanAssist(u) || !i_obj->IsWithinDistInMap(u, i_range))
@@ -941,6 +983,7 @@ namespace MaNGOS
         public:
             FriendlyMissingBuffInRangeInCombatCheck(Unit const* obj, float range, uint32 spellid) : i_obj(obj), i_range(range), i_spell(spellid) {}
             Unit const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 return u->IsAlive() && u->IsInCombat() && i_obj->CanAssist(u) && i_obj->IsWithinDistInMap(u, i_range) && !(u->HasAura(i_spell, EFFECT_INDEX_0) || u->HasAura(i_spell, EFFECT_INDEX_1) || u->HasAura(i_spell, EFFECT_INDEX_2));
@@ -956,6 +999,7 @@ namespace MaNGOS
     public:
         FriendlyMissingBuffInRangeNotInCombatCheck(Unit const* obj, float range, uint32 spellid) : i_obj(obj), i_range(range), i_spell(spellid) {}
         Unit const& GetFocusObject() const { return *i_obj; }
+        float GetSearchRange() const { return i_range; }
         bool operator()(Unit* u)
         {
             return u->IsAlive() && i_obj->CanAssist(u) && i_obj->IsWithinDistInMap(u, i_range) && !(u->HasAura(i_spell, EFFECT_INDEX_0) || u->HasAura(i_spell, EFFECT_INDEX_1) || u->HasAura(i_spell, EFFECT_INDEX_2));
@@ -974,6 +1018,7 @@ namespace MaNGOS
                 i_controlledByPlayer = obj->IsControlledByPlayer();
             }
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u) const
             {
                 // ignore totems
@@ -994,6 +1039,7 @@ namespace MaNGOS
             AnySpellAssistableUnitInObjectRangeCheck(WorldObject const* obj, SpellEntry const* spellInfo, float range)
                 : i_obj(obj), i_spellInfo(spellInfo), i_range(range) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 return u->IsAlive() && i_obj->IsWithinDistInMap(u, i_range) && i_obj->CanAssistSpell(u, i_spellInfo);
@@ -1010,6 +1056,7 @@ namespace MaNGOS
             AnyFriendlyUnitInObjectRangeCheck(WorldObject const* obj, float range)
                 : i_obj(obj), i_range(range) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 return u->IsAlive() && i_obj->IsWithinDistInMap(u, i_range, true) && i_obj->CanAssistSpell(u);
@@ -1087,6 +1134,7 @@ namespace MaNGOS
         public:
             AnyUnitInObjectRangeCheck(WorldObject const* obj, float range) : i_obj(obj), i_range(range) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 return u->IsAlive() && i_obj->IsWithinDistInMap(u, i_range);
@@ -1121,6 +1169,7 @@ namespace MaNGOS
             NearestAttackableUnitInObjectRangeCheck(NearestAttackableUnitInObjectRangeCheck const&) =  delete;
 
             Unit const& GetFocusObject() const { return *m_source; }
+            float GetSearchRange() const { return m_range; }
 
             bool operator()(Unit* currUnit)
             {
@@ -1151,6 +1200,7 @@ namespace MaNGOS
                 i_targetForPlayer = i_obj->IsControlledByPlayer();
             }
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Unit* u)
             {
                 // Check contains checks for: live, non-selectable, non-attackable flags, flight check and GM check, ignore totems
@@ -1226,6 +1276,7 @@ namespace MaNGOS
             NearestAssistCreatureInCreatureRangeCheck(Creature* obj, Unit* enemy, float range)
                 : i_obj(obj), i_enemy(enemy), i_range(range) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Creature* u)
             {
                 if (u == i_obj || u->IsDead() || u->IsInCombat())
@@ -1369,6 +1420,7 @@ namespace MaNGOS
         public:
             AnyPlayerInObjectRangeCheck(WorldObject const* obj, float range) : i_obj(obj), i_range(range) {}
             WorldObject const& GetFocusObject() const { return *i_obj; }
+            float GetSearchRange() const { return i_range; }
             bool operator()(Player* u)
             {
                 return u->IsAlive() && i_obj->IsWithinDistInMap(u, i_range);
@@ -492,6 +492,24 @@ void MaNGOS::DynamicObjectListSearcher<Check>::Visit(DynamicObjectMapType& m)
 
 // Unit searchers
 
+template<class Check>
+bool MaNGOS::UnitSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, (1 << TYPEID_UNIT) | (1 << TYPEID_PLAYER), worldObjects, [&](WorldObject* obj)
+    {
+        // already found
+        if (i_object)
+            return false;
+
+        if (i_check(static_cast<Unit*>(obj)))
+        {
+            i_object = static_cast<Unit*>(obj);
+            return false;
+        }
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::UnitSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -526,6 +544,17 @@ void MaNGOS::UnitSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+template<class Check>
+bool MaNGOS::UnitLastSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, (1 << TYPEID_UNIT) | (1 << TYPEID_PLAYER), worldObjects, [&](WorldObject* obj)
+    {
+        if (i_check(static_cast<Unit*>(obj)))
+            i_object = static_cast<Unit*>(obj);
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::UnitLastSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -546,6 +575,17 @@ void MaNGOS::UnitLastSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+template<class Check>
+bool MaNGOS::UnitListSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, (1 << TYPEID_UNIT) | (1 << TYPEID_PLAYER), worldObjects, [&](WorldObject* obj)
+    {
+        if (i_check(static_cast<Unit*>(obj)))
+            i_objects.push_back(static_cast<Unit*>(obj));
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::UnitListSearcher<Check>::Visit(PlayerMapType& m)
 {
@@ -564,6 +604,24 @@ void MaNGOS::UnitListSearcher<Check>::Visit(CreatureMapType& m)
 
 // Creature searchers
 
+template<class Check>
+bool MaNGOS::CreatureSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, 1 << TYPEID_UNIT, worldObjects, [&](WorldObject* obj)
+    {
+        // already found
+        if (i_object)
+            return false;
+
+        if (i_check(static_cast<Creature*>(obj)))
+        {
+            i_object = static_cast<Creature*>(obj);
+            return false;
+        }
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::CreatureSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -581,6 +639,17 @@ void MaNGOS::CreatureSearcher<Check>::Visit(CreatureMapType& m)
     }
 }
 
+template<class Check>
+bool MaNGOS::CreatureLastSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, 1 << TYPEID_UNIT, worldObjects, [&](WorldObject* obj)
+    {
+        if (i_check(static_cast<Creature*>(obj)))
+            i_object = static_cast<Creature*>(obj);
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::CreatureLastSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -591,6 +660,17 @@ void MaNGOS::CreatureLastSearcher<Check>::Visit(CreatureMapType& m)
     }
 }
 
+template<class Check>
+bool MaNGOS::CreatureListSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, 1 << TYPEID_UNIT, worldObjects, [&](WorldObject* obj)
+    {
+        if (i_check(static_cast<Creature*>(obj)))
+            i_objects.push_back(static_cast<Creature*>(obj));
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::CreatureListSearcher<Check>::Visit(CreatureMapType& m)
 {
@@ -599,6 +679,24 @@ void MaNGOS::CreatureListSearcher<Check>::Visit(CreatureMapType& m)
             i_objects.push_back(itr->getSource());
 }
 
+template<class Check>
+bool MaNGOS::PlayerSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, 1 << TYPEID_PLAYER, worldObjects, [&](WorldObject* obj)
+    {
+        // already found
+        if (i_object)
+            return false;
+
+        if (i_check(static_cast<Player*>(obj)))
+        {
+            i_object = static_cast<Player*>(obj);
+            return false;
+        }
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::PlayerSearcher<Check>::Visit(PlayerMapType& m)
 {
@@ -616,6 +714,17 @@ void MaNGOS::PlayerSearcher<Check>::Visit(PlayerMapType& m)
     }
 }
 
+template<class Check>
+bool MaNGOS::PlayerListSearcher<Check>::VisitIndexed(CellPositionIndex const& index, bool worldObjects)
+{
+    return index.VisitInCheckRange(i_check, 1 << TYPEID_PLAYER, worldObjects, [&](WorldObject* obj)
+    {
+        if (i_check(static_cast<Player*>(obj)))
+            i_objects.push_back(static_cast<Player*>(obj));
+        return true;
+    });
+}
+
 template<class Check>
 void MaNGOS::PlayerListSearcher<Check>::Visit(PlayerMapType& m)
 {
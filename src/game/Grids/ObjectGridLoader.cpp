@@ -111,20 +111,35 @@ template<> void addUnitState(Creature* obj, CellPair const& cell_pair)
     obj->SetCurrentCell(cell);
 }
 
-template <class T>
-void LoadHelper(CellGuidSet const& guid_set, CellPair& cell, GridRefManager<T>& /*m*/, uint32& count, Map* map, GridType& grid)
+// spawn sets of persistent state hold db guids only, spawn image entries carry resolved spawn data
+inline uint32 GetSpawnDbGuid(uint32 guid) { return guid; }
+template<class SPAWN> uint32 GetSpawnDbGuid(SPAWN const& spawn) { return spawn.dbGuid; }
+
+inline uint32 GetSpawnGOEntry(uint32 guid)
+{
+    GameObjectData const* data = sObjectMgr.GetGOData(guid);
+    MANGOS_ASSERT(data);
+    return data->id;
+}
+inline uint32 GetSpawnGOEntry(GameObjectSpawnImage const& spawn) { return spawn.data.id; }
+
+template<class T> bool LoadSpawn(T* obj, uint32 guid, Map* map, uint32 newGuid) { return obj->LoadFromDB(guid, map, newGuid, 0); }
+inline bool LoadSpawn(Creature* obj, CreatureSpawnImage const& spawn, Map* map, uint32 newGuid) { return obj->LoadFromImage(spawn, map, newGuid); }
+inline bool LoadSpawn(GameObject* obj, GameObjectSpawnImage const& spawn, Map* map, uint32 newGuid) { return obj->LoadFromImage(spawn, map, newGuid); }
+
+template <class T, class SPAWNS>
+void LoadHelper(SPAWNS const& spawns, CellPair& cell, GridRefManager<T>& /*m*/, uint32& count, Map* map, GridType& grid)
 {
     BattleGround* bg = map->IsBattleGround() ? ((BattleGroundMap*)map)->GetBG() : nullptr;
 
-    for (uint32 guid : guid_set)
+    for (auto const& spawn : spawns)
     {
+        uint32 guid = GetSpawnDbGuid(spawn);
         T* obj;
         uint32 newGuid = guid;
         if constexpr (std::is_same_v<T, GameObject>)
         {
-            GameObjectData const* data = sObjectMgr.GetGOData(guid);
-            MANGOS_ASSERT(data);
-            obj = (T*)GameObject::CreateGameObject(data->id);
+            obj = (T*)GameObject::CreateGameObject(GetSpawnGOEntry(spawn));
             if (map->GetSpawnManager().IsEventGuid(guid, HIGHGUID_GAMEOBJECT))
                 newGuid = 0;
         }
@@ -135,7 +150,7 @@ void LoadHelper(CellGuidSet const& guid_set, CellPair& cell, GridRefManager<T>&
                 newGuid = 0;
         }
         // sLog.outString("DEBUG: LoadHelper from table: %s for (guid: %u) Loading",table,guid);
-        if (!obj->LoadFromDB(guid, map, newGuid, 0))
+        if (!LoadSpawn(obj, spawn, map, newGuid))
         {
             delete obj;
             continue;
@@ -196,10 +211,10 @@ ObjectGridLoader::Visit(GameObjectMapType& m)
     CellPair cell_pair(x, y);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
-    CellObjectGuids const& cell_guids = sObjectMgr.GetCellObjectGuids(i_map->GetId(), cell_id);
-
     GridType& grid = (*i_map->getNGrid(i_cell.GridX(), i_cell.GridY()))(i_cell.CellX(), i_cell.CellY());
-    LoadHelper(cell_guids.gameobjects, cell_pair, m, i_gameObjects, i_map, grid);
+    MapSpawnImage::const_iterator cellImage = i_spawnImage->find(cell_id);
+    if (cellImage != i_spawnImage->end())
+        LoadHelper(cellImage->second->gameobjects, cell_pair, m, i_gameObjects, i_map, grid);
     LoadHelper(i_map->GetPersistentState()->GetCellObjectGuids(cell_id).gameobjects, cell_pair, m, i_gameObjects, i_map, grid);
 }
 
@@ -211,10 +226,10 @@ ObjectGridLoader::Visit(CreatureMapType& m)
     CellPair cell_pair(x, y);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
-    CellObjectGuids const& cell_guids = sObjectMgr.GetCellObjectGuids(i_map->GetId(), cell_id);
-
     GridType& grid = (*i_map->getNGrid(i_cell.GridX(), i_cell.GridY()))(i_cell.CellX(), i_cell.CellY());
-    LoadHelper(cell_guids.creatures, cell_pair, m, i_creatures, i_map, grid);
+    MapSpawnImage::const_iterator cellImage = i_spawnImage->find(cell_id);
+    if (cellImage != i_spawnImage->end())
+        LoadHelper(cellImage->second->creatures, cell_pair, m, i_creatures, i_map, grid);
     LoadHelper(i_map->GetPersistentState()->GetCellObjectGuids(cell_id).creatures, cell_pair, m, i_creatures, i_map, grid);
 }
 
@@ -226,9 +241,8 @@ ObjectWorldLoader::Visit(CorpseMapType& m)
     CellPair cell_pair(x, y);
     uint32 cell_id = (cell_pair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP) + cell_pair.x_coord;
 
-    CellObjectGuids const& cell_guids = sObjectMgr.GetCellObjectGuids(i_map->GetId(), cell_id);
     GridType& grid = (*i_map->getNGrid(i_cell.GridX(), i_cell.GridY()))(i_cell.CellX(), i_cell.CellY());
-    LoadHelper(cell_guids.corpses, cell_pair, m, i_corpses, i_map, grid);
+    LoadHelper(sObjectMgr.GetCellCorpses(i_map->GetId(), cell_id), cell_pair, m, i_corpses, i_map, grid);
 }
 
 void
@@ -250,6 +264,7 @@ ObjectGridLoader::Load(GridType& grid)
 void ObjectGridLoader::LoadN(void)
 {
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
+    i_spawnImage = sObjectMgr.GetMapSpawnImage(i_map->GetId());
     i_cell.data.Part.cell_y = 0;
     for (unsigned int x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
     {
@@ -257,7 +272,7 @@ void ObjectGridLoader::LoadN(void)
         for (unsigned int y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
         {
             i_cell.data.Part.cell_y = y;
-            GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes> loader;
+            GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> loader;
             loader.Load(i_grid(x, y), *this);
         }
     }
@@ -26,6 +26,8 @@
 #include "Grids/Cell.h"
 
 class ObjectWorldLoader;
+struct CellSpawnImage;
+typedef std::unordered_map < uint32/*cell_id*/, std::shared_ptr<CellSpawnImage const> > MapSpawnImage;
 
 class ObjectGridLoader
 {
@@ -52,6 +54,7 @@ class ObjectGridLoader
         uint32 i_gameObjects;
         uint32 i_creatures;
         uint32 i_corpses;
+        std::shared_ptr<MapSpawnImage const> i_spawnImage;  // static spawns, shared by all instances of the map
 };
 
 class ObjectGridUnloader
@@ -66,7 +69,7 @@ class ObjectGridUnloader
             {
                 for (unsigned int y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
                 {
-                    GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes> loader;
+                    GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> loader;
                     loader.Unload(i_grid(x, y), *this);
                 }
             }
@@ -89,7 +92,7 @@ class ObjectGridStoper
             {
                 for (unsigned int y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
                 {
-                    GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes> loader;
+                    GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> loader;
                     loader.Stop(i_grid(x, y), *this);
                 }
             }
@@ -103,6 +106,6 @@ class ObjectGridStoper
         NGridType& i_grid;
 };
 
-typedef GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes> GridLoaderType;
+typedef GridLoader<Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> GridLoaderType;
 
 #endif
@@ -56,6 +56,29 @@ LootStore LootTemplates_Pickpocketing("pickpocketing_loot_template", "creature p
 LootStore LootTemplates_Reference("reference_loot_template",    "reference id",                   false);
 LootStore LootTemplates_Skinning("skinning_loot_template",     "creature skinning id",           true);
 
+LootStore* GetLootStoreByName(std::string const& name)
+{
+    if (name == "creature")
+        return &LootTemplates_Creature;
+    if (name == "gameobject")
+        return &LootTemplates_Gameobject;
+    if (name == "fishing")
+        return &LootTemplates_Fishing;
+    if (name == "item")
+        return &LootTemplates_Item;
+    if (name == "pickpocketing")
+        return &LootTemplates_Pickpocketing;
+    if (name == "skinning")
+        return &LootTemplates_Skinning;
+    if (name == "disenchanting")
+        return &LootTemplates_Disenchant;
+    if (name == "mail")
+        return &LootTemplates_Mail;
+    if (name == "reference")
+        return &LootTemplates_Reference;
+    return nullptr;
+}
+
 // Remove all data and free all memory
 void LootStore::Clear()
 {
@@ -185,6 +208,7 @@ void LootStore::LoadLootTable()
         while (queryResult->NextRow());
 
         Verify();                                           // Checks validity of the loot store
+        Compile();
 
         sLog.outString(">> Loaded %u loot definitions (" SIZEFMTD " templates) from table %s", count, m_LootTemplates.size(), GetName());
         sLog.outString();
@@ -216,6 +240,19 @@ bool LootStore::HaveQuestLootForPlayer(uint32 loot_id, Player* player) const
     return false;
 }
 
+// Prepares all templates for rolling, references are resolved against the current reference store
+void LootStore::Compile()
+{
+    for (auto& itr : m_LootTemplates)
+        itr.second.Compile();
+}
+
+void LootStore::CollectLootIds(LootIdSet& ids_set) const
+{
+    for (auto const& itr : m_LootTemplates)
+        ids_set.insert(itr.first);
+}
+
 LootTemplate const* LootStore::GetLootFor(uint32 loot_id) const
 {
     LootTemplateMap::const_iterator tab = m_LootTemplates.find(loot_id);
@@ -2346,7 +2383,22 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem const& item)
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot const& loot, Player const* lootOwner) const
 {
-    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
+    if (!CumulativeChances.empty())                         // First explicitly chanced entries are checked
+    {
+        // chances do not overlap, so a single roll on the running sums has the same odds as the shuffled walk below
+        // an entry failing its condition is a miss, as its part of the range is then skipped by the walk too
+        float chance = rand_chance_f();
+        auto itr = std::upper_bound(CumulativeChances.begin(), CumulativeChances.end(), chance);
+        if (itr != CumulativeChances.end())
+        {
+            LootStoreItem const* lsi = &ExplicitlyChanced[itr - CumulativeChances.begin()];
+            if (!lsi->conditionId || !lootOwner || LootTemplate::PlayerOrGroupFulfilsCondition(loot, lootOwner, lsi->conditionId))
+                return lsi;
+
+            sLog.outDebug("In explicit chance -> This item cannot be added! (%u)", lsi->itemid);
+        }
+    }
+    else if (!ExplicitlyChanced.empty())
     {
         std::vector <LootStoreItem const*> lootStoreItemVector; // we'll use new vector to make easy the randomization
 
@@ -2381,11 +2433,19 @@ LootStoreItem const* LootTemplate::LootGroup::Roll(Loot const& loot, Player cons
 
     if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
     {
+        // the first entry of the shuffled list, mostly taken as is without building the list
+        uint32 const first = urand(0, EqualChanced.size() - 1);
+        LootStoreItem const* firstLsi = &EqualChanced[first];
+        bool const firstPassed = loot.IsItemAlreadyIn(firstLsi->itemid) && urand(0, 1);
+        if (!firstPassed && (!firstLsi->conditionId || !lootOwner || LootTemplate::PlayerOrGroupFulfilsCondition(loot, lootOwner, firstLsi->conditionId)))
+            return firstLsi;
+
         std::vector <LootStoreItem const*> lootStoreItemVector; // we'll use new vector to make easy the randomization
 
-        // fill the new vector with correct pointer to our item list
-        for (auto& itr : EqualChanced)
-            lootStoreItemVector.push_back(&itr);
+        // fill the new vector with correct pointer to the remaining items
+        for (uint32 i = 0; i < EqualChanced.size(); ++i)
+            if (i != first)
+                lootStoreItemVector.push_back(&EqualChanced[i]);
 
         // randomize the new vector
         std::shuffle(lootStoreItemVector.begin(), lootStoreItemVector.end(), *GetRandomGenerator());
@@ -2463,7 +2523,7 @@ void LootTemplate::LootGroup::Process(Loot& loot, Player const* lootOwner, bool
         else
         {
             // we should continue and get next loot reference to process this loot list
-            LootTemplate const* lRef = LootTemplates_Reference.GetLootFor(-item->mincountOrRef);
+            LootTemplate const* lRef = item->reference;
 
             if (lRef)
             {
@@ -2539,6 +2599,25 @@ bool LootTemplate::LootGroup::CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevR
     return true;
 }
 
+void LootTemplate::LootGroup::Compile()
+{
+    for (auto& lsi : ExplicitlyChanced)
+        lsi.reference = lsi.mincountOrRef < 0 ? LootTemplates_Reference.GetLootFor(-lsi.mincountOrRef) : nullptr;
+    for (auto& lsi : EqualChanced)
+        lsi.reference = lsi.mincountOrRef < 0 ? LootTemplates_Reference.GetLootFor(-lsi.mincountOrRef) : nullptr;
+
+    // with a total above 100% the result depends on the order, such groups keep the shuffled walk
+    CumulativeChances.clear();
+    float total = 0.0f;
+    for (auto const& lsi : ExplicitlyChanced)
+    {
+        total += lsi.chance;
+        CumulativeChances.push_back(total);
+    }
+    if (total > 100.0f)
+        CumulativeChances.clear();
+}
+
 //
 // --------- LootTemplate ---------
 //
@@ -2577,7 +2656,7 @@ void LootTemplate::Process(Loot& loot, Player const* lootOwner, bool rate, LootS
 
         if (Entrie.mincountOrRef < 0)                           // References processing
         {
-            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(-Entrie.mincountOrRef);
+            LootTemplate const* Referenced = Entrie.reference;
 
             if (!Referenced)
                 continue;                                   // Error message already printed at loading stage
@@ -2719,6 +2798,15 @@ bool LootTemplate::CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevRefs)
     return true;
 }
 
+void LootTemplate::Compile()
+{
+    for (auto& Entrie : Entries)
+        Entrie.reference = Entrie.mincountOrRef < 0 ? LootTemplates_Reference.GetLootFor(-Entrie.mincountOrRef) : nullptr;
+
+    for (auto& Group : Groups)
+        Group.Compile();
+}
+
 void LoadLootTemplates_Creature()
 {
     LootIdSet ids_set, ids_setUsed;
@@ -2909,10 +2997,25 @@ void LoadLootTemplates_Skinning()
     LootTemplates_Skinning.ReportUnusedIds(ids_set);
 }
 
+// References of all stores point into the reference store
+static void CompileLootTemplates()
+{
+    LootTemplates_Creature.Compile();
+    LootTemplates_Fishing.Compile();
+    LootTemplates_Gameobject.Compile();
+    LootTemplates_Item.Compile();
+    LootTemplates_Pickpocketing.Compile();
+    LootTemplates_Skinning.Compile();
+    LootTemplates_Disenchant.Compile();
+    LootTemplates_Mail.Compile();
+    LootTemplates_Reference.Compile();
+}
+
 void LoadLootTemplates_Reference(LootIdSet& ids_set)
 {    
     LootTemplates_Reference.LoadAndCollectLootIds(ids_set);
     LootTemplates_Reference.LoadAndCheckReferenceNames();
+    CompileLootTemplates();
 }
 
 void CheckLootTemplates_Reference(LootIdSet& ids_set)
@@ -2933,6 +3036,9 @@ void CheckLootTemplates_Reference(LootIdSet& ids_set)
 
     // output error for any still listed ids (not referenced from any loot table)
     LootTemplates_Reference.ReportUnusedIds(ids_set);
+
+    // looping references may have been cut
+    CompileLootTemplates();
 }
 
 // Vote for an ongoing roll
@@ -3023,28 +3129,9 @@ Loot* LootMgr::GetLoot(Player* player, ObjectGuid const& targetGuid) const
 void LootMgr::CheckDropStats(ChatHandler& chat, uint32 amountOfCheck, uint32 lootId, std::string lootStore, bool full) const
 {
     // choose correct loot template
-    LootStore* store = &LootTemplates_Creature;
-    if (lootStore != "creature")
-    {
-        if (lootStore == "gameobject")
-            store = &LootTemplates_Gameobject;
-        else if (lootStore == "fishing")
-            store = &LootTemplates_Fishing;
-        else if (lootStore == "item")
-            store = &LootTemplates_Item;
-        else if (lootStore == "pickpocketing")
-            store = &LootTemplates_Pickpocketing;
-        else if (lootStore == "skinning")
-            store = &LootTemplates_Skinning;
-        else if (lootStore == "disenchanting")
-            store = &LootTemplates_Disenchant;
-        else if (lootStore == "mail")
-            store = &LootTemplates_Mail;
-        else if (lootStore == "reference")
-            store = &LootTemplates_Reference;
-        else
-            return;
-    }
+    LootStore* store = GetLootStoreByName(lootStore);
+    if (!store)
+        return;
 
     if (amountOfCheck < 1)
         amountOfCheck = 1;
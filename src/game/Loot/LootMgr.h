@@ -209,12 +209,13 @@ struct LootStoreItem
     bool    needs_quest : 1;                                // quest drop (negative ChanceOrQuestChance in DB)
     uint8   maxcount    : 8;                                // max drop count for the item (mincountOrRef positive) or Ref multiplicator (mincountOrRef negative)
     uint16  conditionId : 16;                               // additional loot condition Id
+    LootTemplate const* reference;                          // referenced template resolved by LootStore::Compile, nullptr for items
 
     // Constructor, converting ChanceOrQuestChance -> (chance, needs_quest)
     // displayid is filled in IsValid() which must be called after
     LootStoreItem(uint32 _itemIndex, uint32 _itemid, float _chanceOrQuestChance, int8 _group, uint16 _conditionId, int32 _mincountOrRef, uint8 _maxcount)
         : itemIndex(_itemIndex), itemid(_itemid), chance(fabs(_chanceOrQuestChance)), mincountOrRef(_mincountOrRef),
-          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId)
+          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId), reference(nullptr)
     {}
 
     bool Roll(bool rate) const;                             // Checks if the entry takes it's chance (at loot generation)
@@ -274,10 +275,12 @@ class LootTemplate
 
                 void Verify(LootStore const& lootstore, uint32 id, uint32 group_id) const;
                 bool CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevRefs);
+                void Compile();                                     // Resolves references and builds the chance table
 
             private:
                 LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
                 LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+                std::vector<float> CumulativeChances;               // Running chance sums of ExplicitlyChanced, empty if they exceed 100%
 
                 // Rolls an item from the group, returns nullptr if all miss their chances
                 LootStoreItem const* Roll(Loot const& loot, Player const* lootOwner) const;
@@ -300,6 +303,8 @@ class LootTemplate
         // Checks integrity of the template
         void Verify(LootStore const& lootstore, uint32 id) const;
         bool CheckLootRefs(LootIdSet* ref_set, LootIdSet& prevRefs);
+        // Resolves references and prepares the groups for fast rolling, after any loot store (re)load
+        void Compile();
     private:
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimized) processing, grouped entries go there
@@ -325,6 +330,9 @@ class LootStore
         bool HaveQuestLootForPlayer(uint32 loot_id, Player* player) const;
 
         LootTemplate const* GetLootFor(uint32 loot_id) const;
+        void CollectLootIds(LootIdSet& ids_set) const;
+
+        void Compile();
 
         char const* GetName() const { return m_name; }
         char const* GetEntryName() const { return m_entryName; }
@@ -354,6 +362,7 @@ class Loot
         friend struct LootItem;
         friend class GroupLootRoll;
         friend class LootMgr;
+        friend class LootSimulator;
 
         Loot(Player* player, Creature* creature, LootType type);
         Loot(Player* player, GameObject* gameObject, LootType type);
@@ -454,6 +463,9 @@ extern LootStore LootTemplates_Pickpocketing;
 extern LootStore LootTemplates_Skinning;
 extern LootStore LootTemplates_Disenchant;
 
+// store by its short name as used in .loot stats: creature, gameobject, fishing, item, pickpocketing, skinning, disenchanting, mail, reference
+LootStore* GetLootStoreByName(std::string const& name);
+
 void LoadLootTemplates_Creature();
 void LoadLootTemplates_Fishing();
 void LoadLootTemplates_Gameobject();
@@ -0,0 +1,342 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Loot/LootSimulator.h"
+#include "Loot/LootMgr.h"
+#include "Log/Log.h"
+#include "Util/Util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // drop rate differences beyond this many standard errors of the two samples are reported
+    double const SIGNIFICANT_SIGMA = 4.0;
+
+    uint32 BucketOf(uint64 ns)
+    {
+        uint32 bucket = 0;
+        while (bucket < LOOT_SIM_LATENCY_BUCKETS - 1 && ns >= (uint64(1) << bucket))
+            ++bucket;
+        return bucket;
+    }
+}
+
+void LootSimResult::Merge(LootSimResult const& other)
+{
+    rolls += other.rolls;
+    totalNs += other.totalNs;
+    for (uint32 i = 0; i < LOOT_SIM_LATENCY_BUCKETS; ++i)
+        latencyBuckets[i] += other.latencyBuckets[i];
+    for (auto const& drop : other.drops)
+        drops[drop.first] += drop.second;
+}
+
+uint64 LootSimResult::LatencyPercentile(uint32 pct) const
+{
+    if (!rolls)
+        return 0;
+
+    uint64 const rank = (rolls * pct + 99) / 100;
+    uint64 seen = 0;
+    for (uint32 i = 0; i < LOOT_SIM_LATENCY_BUCKETS; ++i)
+    {
+        seen += latencyBuckets[i];
+        if (seen >= rank)
+            return uint64(1) << i;
+    }
+    return uint64(1) << (LOOT_SIM_LATENCY_BUCKETS - 1);
+}
+
+bool LootSimulator::ParseTargets()
+{
+    m_results.clear();
+
+    Tokens targets = StrSplit(m_config.targets, ",");
+    for (std::string const& target : targets)
+    {
+        std::string::size_type const sep = target.find(':');
+        LootStore const* store = sep != std::string::npos ? GetLootStoreByName(target.substr(0, sep)) : nullptr;
+        if (!store)
+        {
+            sLog.outError("LootSimulator: invalid target '%s', expected store:lootId or store:all", target.c_str());
+            return false;
+        }
+
+        LootIdSet ids;
+        std::string const id = target.substr(sep + 1);
+        if (id == "all")
+            store->CollectLootIds(ids);
+        else
+        {
+            uint32 const lootId = uint32(atoi(id.c_str()));
+            if (!store->GetLootFor(lootId))
+            {
+                sLog.outError("LootSimulator: no loot id %u in %s", lootId, store->GetName());
+                return false;
+            }
+            ids.insert(lootId);
+        }
+
+        for (uint32 lootId : ids)
+        {
+            LootSimResult result;
+            result.store = store;
+            result.lootId = lootId;
+            m_results.push_back(result);
+        }
+    }
+
+    if (m_results.empty())
+    {
+        sLog.outError("LootSimulator: nothing to simulate for '%s'", m_config.targets.c_str());
+        return false;
+    }
+    return true;
+}
+
+void LootSimulator::Simulate(Loot& loot, LootSimResult& result, uint32 rolls) const
+{
+    LootTemplate const* lootTable = result.store->GetLootFor(result.lootId);
+    bool const rate = result.store->IsRatesAllowed();
+
+    for (uint32 i = 0; i < rolls; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        lootTable->Process(loot, nullptr, rate);
+        uint64 const ns = uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        ++result.rolls;
+        result.totalNs += ns;
+        ++result.latencyBuckets[BucketOf(ns)];
+        for (LootItem const* lootItem : loot.m_lootItems)
+            ++result.drops[lootItem->itemId];
+
+        loot.Clear();
+    }
+}
+
+int LootSimulator::Run()
+{
+    if (!ParseTargets())
+        return 1;
+
+    uint32 const threads = std::max(m_config.threads, 1u);
+    uint32 const rolls = std::max(m_config.rolls, 1u);
+    sLog.outString("LootSimulator: %u rolls for each of %u loot ids on %u threads", rolls, uint32(m_results.size()), threads);
+
+    // each loot id is split in one chunk per thread, so single big targets use all threads too
+    struct Chunk
+    {
+        uint32 result;
+        uint32 rolls;
+    };
+    std::vector<Chunk> chunks;
+    uint32 const chunkRolls = (rolls + threads - 1) / threads;
+    for (uint32 i = 0; i < m_results.size(); ++i)
+        for (uint32 done = 0; done < rolls; done += chunkRolls)
+            chunks.push_back({ i, std::min(chunkRolls, rolls - done) });
+
+    std::vector<std::vector<LootSimResult>> workerResults(threads, m_results);
+    std::atomic<size_t> nextChunk(0);
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (uint32 i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([this, &chunks, &nextChunk, &results = workerResults[i]]()
+        {
+            Loot loot(LOOT_DEBUG);
+            for (size_t chunk = nextChunk++; chunk < chunks.size(); chunk = nextChunk++)
+                Simulate(loot, results[chunks[chunk].result], chunks[chunk].rolls);
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    uint64 const elapsedMs = uint64(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    for (std::vector<LootSimResult> const& results : workerResults)
+        for (uint32 i = 0; i < m_results.size(); ++i)
+            m_results[i].Merge(results[i]);
+
+    PrintSummary(elapsedMs);
+
+    if (!m_config.output.empty() && !WriteReport(m_config.output))
+        return 1;
+
+    if (!m_config.baseline.empty())
+    {
+        Baseline baseline;
+        if (!LoadReport(m_config.baseline, baseline))
+            return 1;
+
+        if (CompareWithBaseline(baseline))
+            return 1;
+    }
+
+    return 0;
+}
+
+void LootSimulator::PrintSummary(uint64 elapsedMs) const
+{
+    LootSimResult total;
+    for (LootSimResult const& result : m_results)
+        total.Merge(result);
+
+    sLog.outString("LootSimulator: " UI64FMTD " rolls in " UI64FMTD " ms, %.1f rolls/s", total.rolls, elapsedMs, elapsedMs ? total.rolls * 1000.0 / elapsedMs : 0.0);
+    sLog.outString("LootSimulator: roll latency mean " UI64FMTD " ns, p50 <" UI64FMTD " ns, p99 <" UI64FMTD " ns, max <" UI64FMTD " ns",
+        total.rolls ? total.totalNs / total.rolls : 0, total.LatencyPercentile(50), total.LatencyPercentile(99), total.LatencyPercentile(100));
+
+    // per loot id details only for small runs, the report file has them all
+    if (m_results.size() > 20)
+        return;
+
+    for (LootSimResult const& result : m_results)
+    {
+        sLog.outString("%s[%u]: mean " UI64FMTD " ns, p99 <" UI64FMTD " ns", result.store->GetName(), result.lootId,
+            result.rolls ? result.totalNs / result.rolls : 0, result.LatencyPercentile(99));
+
+        std::vector<std::pair<uint32, uint64>> drops(result.drops.begin(), result.drops.end());
+        std::sort(drops.begin(), drops.end(), [](std::pair<uint32, uint64> const& left, std::pair<uint32, uint64> const& right)
+        {
+            return left.second > right.second;
+        });
+        for (auto const& drop : drops)
+            sLog.outString("  item %u: %.4f%%", drop.first, drop.second * 100.0 / result.rolls);
+    }
+}
+
+// report format, one record per line:
+//   loot <store> <lootId> <rolls> <meanNs> <p50Ns> <p99Ns>
+//   item <store> <lootId> <itemId> <drops>
+bool LootSimulator::WriteReport(std::string const& filename) const
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        sLog.outError("LootSimulator: cannot write report %s", filename.c_str());
+        return false;
+    }
+
+    file << "# loot simulation report\n";
+    for (LootSimResult const& result : m_results)
+    {
+        file << "loot " << result.store->GetName() << ' ' << result.lootId << ' ' << result.rolls << ' '
+             << (result.rolls ? result.totalNs / result.rolls : 0) << ' ' << result.LatencyPercentile(50) << ' ' << result.LatencyPercentile(99) << '\n';
+        for (auto const& drop : result.drops)
+            file << "item " << result.store->GetName() << ' ' << result.lootId << ' ' << drop.first << ' ' << drop.second << '\n';
+    }
+
+    sLog.outString("LootSimulator: report written to %s", filename.c_str());
+    return true;
+}
+
+bool LootSimulator::LoadReport(std::string const& filename, Baseline& baseline)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        sLog.outError("LootSimulator: cannot read baseline %s", filename.c_str());
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream stream(line);
+        std::string type, store;
+        uint32 lootId;
+        if (!(stream >> type >> store >> lootId))
+            continue;
+
+        BaselineEntry& entry = baseline[std::make_pair(store, lootId)];
+        if (type == "loot")
+            stream >> entry.rolls >> entry.meanNs;
+        else if (type == "item")
+        {
+            uint32 itemId;
+            uint64 drops;
+            if (stream >> itemId >> drops)
+                entry.drops[itemId] = drops;
+        }
+    }
+    return true;
+}
+
+uint32 LootSimulator::CompareWithBaseline(Baseline const& baseline) const
+{
+    uint32 differences = 0;
+    uint64 baseNs = 0, baseRolls = 0, ownNs = 0, ownRolls = 0;
+
+    for (LootSimResult const& result : m_results)
+    {
+        auto itr = baseline.find(std::make_pair(std::string(result.store->GetName()), result.lootId));
+        if (itr == baseline.end() || !itr->second.rolls)
+        {
+            sLog.outString("LootSimulator: %s[%u] not in baseline", result.store->GetName(), result.lootId);
+            continue;
+        }
+
+        BaselineEntry const& base = itr->second;
+        baseNs += base.meanNs * base.rolls;
+        baseRolls += base.rolls;
+        ownNs += result.totalNs;
+        ownRolls += result.rolls;
+
+        std::map<uint32, std::pair<uint64, uint64>> items;  // item id -> baseline drops, own drops
+        for (auto const& drop : base.drops)
+            items[drop.first].first = drop.second;
+        for (auto const& drop : result.drops)
+            items[drop.first].second = drop.second;
+
+        for (auto const& item : items)
+        {
+            double const baseRate = double(item.second.first) / base.rolls;
+            double const ownRate = double(item.second.second) / result.rolls;
+            double const pooled = double(item.second.first + item.second.second) / (base.rolls + result.rolls);
+            double const error = sqrt(pooled * (1.0 - pooled) * (1.0 / base.rolls + 1.0 / result.rolls));
+            double const delta = std::fabs(ownRate - baseRate);
+            if (delta > 0.0 && delta > SIGNIFICANT_SIGMA * error)
+            {
+                sLog.outError("LootSimulator: %s[%u] item %u drop rate %.4f%% -> %.4f%%", result.store->GetName(), result.lootId,
+                    item.first, baseRate * 100.0, ownRate * 100.0);
+                ++differences;
+            }
+        }
+    }
+
+    if (baseRolls && ownRolls)
+    {
+        double const baseMean = double(baseNs) / baseRolls;
+        double const ownMean = double(ownNs) / ownRolls;
+        sLog.outString("LootSimulator: mean roll latency %.0f ns -> %.0f ns (%+.1f%%)", baseMean, ownMean,
+            baseMean > 0.0 ? (ownMean - baseMean) * 100.0 / baseMean : 0.0);
+    }
+
+    sLog.outString("LootSimulator: %u drop rate differences to baseline %s", differences, m_config.baseline.c_str());
+    return differences;
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_LOOTSIMULATOR_H
+#define MANGOS_LOOTSIMULATOR_H
+
+#include "Common.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class Loot;
+class LootStore;
+
+#define LOOT_SIM_LATENCY_BUCKETS 32                         // log2 buckets of the roll time in ns
+
+struct LootSimulatorConfig
+{
+    LootSimulatorConfig() : rolls(100000), threads(1) {}
+
+    std::string targets;                                    // store:lootId or store:all, comma separated
+    uint32 rolls;                                           // rolls per loot id
+    uint32 threads;
+    std::string output;                                     // report file, empty for none
+    std::string baseline;                                   // report of a previous run to compare with, empty for none
+};
+
+struct LootSimResult
+{
+    LootSimResult() : store(nullptr), lootId(0), rolls(0), totalNs(0), latencyBuckets() {}
+
+    LootStore const* store;
+    uint32 lootId;
+    uint64 rolls;
+    uint64 totalNs;                                         // time spent in LootTemplate::Process
+    uint64 latencyBuckets[LOOT_SIM_LATENCY_BUCKETS];
+    std::map<uint32, uint64> drops;                         // item id -> rolls that dropped it
+
+    void Merge(LootSimResult const& other);
+    uint64 LatencyPercentile(uint32 pct) const;             // upper bound in ns
+};
+
+/*
+  @class LootSimulator
+  Headless loot roll simulation over the loaded loot stores, run by mangosd --lootsim instead of the world.
+  Rolls are spread over worker threads, each with its own Loot and results merged at the end. The report
+  holds drop rates and roll latency per loot id and can be compared with the report of another build or
+  data set, drop rate differences beyond the sampling noise are listed.
+ */
+class LootSimulator
+{
+    public:
+        explicit LootSimulator(LootSimulatorConfig const& config) : m_config(config) {}
+
+        // process exit code, 0 if all targets were simulated and no drop rate differs from the baseline
+        int Run();
+
+    private:
+        struct BaselineEntry
+        {
+            uint64 rolls;
+            uint64 meanNs;
+            std::map<uint32, uint64> drops;
+        };
+        typedef std::map<std::pair<std::string, uint32>, BaselineEntry> Baseline;
+
+        bool ParseTargets();
+        void Simulate(Loot& loot, LootSimResult& result, uint32 rolls) const;
+        void PrintSummary(uint64 elapsedMs) const;
+        bool WriteReport(std::string const& filename) const;
+        static bool LoadReport(std::string const& filename, Baseline& baseline);
+        uint32 CompareWithBaseline(Baseline const& baseline) const;
+
+        LootSimulatorConfig m_config;
+        std::vector<LootSimResult> m_results;
+};
+
+#endif
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "GameSystem/NGrid.h"
+#include "Grids/CellPositionIndex.h"
 #include <cmath>
 
 // Forward class definitions
@@ -75,8 +76,8 @@ typedef GridRefManager<DynamicObject>   DynamicObjectMapType;
 typedef GridRefManager<GameObject>      GameObjectMapType;
 typedef GridRefManager<Player>          PlayerMapType;
 
-typedef Grid<Player, AllWorldObjectTypes, AllGridObjectTypes> GridType;
-typedef NGrid<MAX_NUMBER_OF_CELLS, Player, AllWorldObjectTypes, AllGridObjectTypes> NGridType;
+typedef Grid<Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> GridType;
+typedef NGrid<MAX_NUMBER_OF_CELLS, Player, AllWorldObjectTypes, AllGridObjectTypes, CellPositionIndex> NGridType;
 
 typedef TypeMapContainer<AllGridObjectTypes> GridTypeMapContainer;
 typedef TypeMapContainer<AllWorldObjectTypes> WorldTypeMapContainer;
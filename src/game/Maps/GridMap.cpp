@@ -24,6 +24,7 @@
 #include "Server/DBCStores.h"
 #include "Maps/GridMap.h"
 #include "VMapFactory.h"
+#include "vmap/MapTree.h"
 #include "MotionGenerators/MoveMap.h"
 #include "World/World.h"
 #include "Policies/Singleton.h"
@@ -699,6 +700,7 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
             m_GridMaps[i][k] = nullptr;
             m_GridRef[i][k] = 0;
             m_GridMapsLoadAttempted[i][k] = false;
+            m_GridPrefetched[i][k] = false;
         }
     }
 
@@ -731,6 +733,16 @@ GridMap* TerrainInfo::Load(const uint32 x, const uint32 y, bool mapOnly /*= fals
     // reference grid as a first step
     RefGrid(x, y);
 
+    // the first user takes over the reference of the prefetch thread
+    {
+        LOCK_GUARD _lock(m_refMutex);
+        if (m_GridPrefetched[x][y])
+        {
+            m_GridPrefetched[x][y] = false;
+            --m_GridRef[x][y];
+        }
+    }
+
     // quick check if GridMap already loaded
     GridMap* pMap = m_GridMaps[x][y];
     if (!pMap)
@@ -770,11 +782,25 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
     {
         for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
         {
-            const int16& iRef = m_GridRef[x][y];
             GridMap* pMap = m_GridMaps[x][y];
+            if (!pMap)
+                continue;
+
+            {
+                LOCK_GUARD _lock(m_refMutex);
+                // prefetched but not used since last clean up: drop prefetch reference, unloaded next time if still unused
+                if (m_GridPrefetched[x][y])
+                {
+                    m_GridPrefetched[x][y] = false;
+                    --m_GridRef[x][y];
+                    continue;
+                }
+
+                if (m_GridRef[x][y] != 0)
+                    continue;
+            }
 
             // delete those GridMap objects which have refcount = 0
-            if (pMap && iRef == 0)
             {
                 m_GridMaps[x][y] = nullptr;
                 m_GridMapsLoadAttempted[x][y] = false;
@@ -802,6 +828,63 @@ bool TerrainInfo::CanCheckLiquidLevel(float x, float y) const
     return const_cast<TerrainInfo*>(this)->GetGrid(x, y);
 }
 
+// read whole file so following load is served from OS file cache
+static void ReadAheadFile(std::string const& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return;
+
+    char buffer[64 * 1024];
+    while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer)) {}
+    fclose(file);
+}
+
+void TerrainInfo::PrefetchGrid(const uint32 x, const uint32 y)
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    // GridMap is private data until published, so it is parsed outside of the lock
+    // published objects are not touched here, CleanUpGrids may delete them once unreferenced
+    if (!m_GridMaps[x][y])
+    {
+        char fileName[12];
+        snprintf(fileName, sizeof(fileName), "%03u%02u%02u.map", m_mapId, x, y);
+
+        GridMap* map = new GridMap();
+        if (map->loadData((sWorld.GetDataPath() + "maps/" + fileName).c_str()))
+        {
+            LOCK_GUARD lock(m_mutex);
+            if (!m_GridMaps[x][y])
+            {
+                // referenced before it is visible, CleanUpGrids must not unload it before its first user
+                {
+                    LOCK_GUARD refLock(m_refMutex);
+                    ++m_GridRef[x][y];
+                    m_GridPrefetched[x][y] = true;
+                }
+                m_GridMaps[x][y] = map;
+                map = nullptr;
+            }
+        }
+
+        // failed or loaded meanwhile, error is reported by the synchronous load
+        if (map)
+        {
+            map->unloadData();
+            delete map;
+        }
+    }
+
+    // vmap and mmap tiles are inserted into trees queried by map update threads, so they are only read ahead here
+    ReadAheadFile(sWorld.GetDataPath() + "vmaps/" + VMAP::StaticMapTree::getTileFileName(m_mapId, x, y));
+
+    char mmapFileName[20];
+    snprintf(mmapFileName, sizeof(mmapFileName), "%03u%02u%02u.mmtile", m_mapId, x, y);
+    ReadAheadFile(sWorld.GetDataPath() + "mmaps/" + mmapFileName);
+}
+
 int TerrainInfo::RefGrid(const uint32& x, const uint32& y)
 {
     MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
@@ -1327,12 +1410,14 @@ float TerrainInfo::GetWaterLevel(float x, float y, float z, float* pGround /*= n
 INSTANTIATE_SINGLETON_2(TerrainManager, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(TerrainManager, std::mutex);
 
-TerrainManager::TerrainManager()
+TerrainManager::TerrainManager() : m_prefetchStop(false)
 {
 }
 
 TerrainManager::~TerrainManager()
 {
+    StopGridPrefetch();
+
     for (auto& it : i_TerrainMap)
         delete it.second;
 }
@@ -1380,12 +1465,91 @@ void TerrainManager::Update(const uint32 diff)
 
 void TerrainManager::UnloadAll()
 {
+    StopGridPrefetch();
+
     for (auto& it : i_TerrainMap)
         delete it.second;
 
     i_TerrainMap.clear();
 }
 
+void TerrainManager::QueueGridPrefetch(const uint32 mapId, const uint32 x, const uint32 y)
+{
+    // bounded, requests of players passing by quickly are simply dropped
+    const size_t maxQueuedPrefetches = 64;
+
+    std::lock_guard<std::mutex> lock(m_prefetchQueueMutex);
+    if (m_prefetchStop || m_prefetchQueue.size() >= maxQueuedPrefetches)
+        return;
+
+    uint64 key = MakePrefetchKey(mapId, x, y);
+    if (!m_prefetchQueued.insert(key).second)
+        return;
+
+    m_prefetchQueue.push_back(key);
+
+    if (!m_prefetchThread.joinable())
+        m_prefetchThread = std::thread(&TerrainManager::PrefetchWorker, this);
+
+    m_prefetchCondition.notify_one();
+}
+
+void TerrainManager::PrefetchWorker()
+{
+    while (true)
+    {
+        uint64 key;
+        {
+            std::unique_lock<std::mutex> lock(m_prefetchQueueMutex);
+            m_prefetchCondition.wait(lock, [this] { return m_prefetchStop || !m_prefetchQueue.empty(); });
+            if (m_prefetchStop)
+                return;
+
+            key = m_prefetchQueue.front();
+            m_prefetchQueue.pop_front();
+        }
+
+        // the terrain is referenced instead of locked during file reads, UnloadTerrain keeps referenced terrain
+        TerrainInfo* terrain = nullptr;
+        {
+            Guard _guard(*this);
+            TerrainDataMap::const_iterator iter = i_TerrainMap.find(uint32(key >> 32));
+            if (iter != i_TerrainMap.end())
+            {
+                terrain = iter->second;
+                terrain->AddRef();
+            }
+        }
+
+        if (terrain)
+        {
+            terrain->PrefetchGrid(uint32(key >> 16) & 0xFFFF, uint32(key) & 0xFFFF);
+
+            // last map of the terrain was unloaded meanwhile
+            if (terrain->Release())
+                UnloadTerrain(uint32(key >> 32));
+        }
+
+        // allow requeue only after done, grid may have been cleaned up meanwhile
+        std::lock_guard<std::mutex> lock(m_prefetchQueueMutex);
+        m_prefetchQueued.erase(key);
+    }
+}
+
+void TerrainManager::StopGridPrefetch()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_prefetchQueueMutex);
+        m_prefetchStop = true;
+        m_prefetchQueue.clear();
+        m_prefetchQueued.clear();
+    }
+    m_prefetchCondition.notify_all();
+
+    if (m_prefetchThread.joinable())
+        m_prefetchThread.join();
+}
+
 uint32 TerrainManager::GetAreaIdByAreaFlag(uint16 areaflag, uint32 map_id)
 {
     AreaTableEntry const* entry = GetAreaEntryByAreaFlagAndMap(areaflag, map_id);
@@ -27,7 +27,11 @@
 #include "Maps/GridMapDefines.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <set>
+#include <thread>
 
 class Creature;
 class Unit;
@@ -176,6 +180,10 @@ class TerrainInfo : public Referencable<std::atomic_long>
 
         bool CanCheckLiquidLevel(float x, float y) const;
 
+        // this method should be used only by TerrainManager prefetch thread
+        // reads terrain data of a grid expected to be loaded soon, see TerrainManager::QueueGridPrefetch
+        void PrefetchGrid(const uint32 x, const uint32 y);
+
     protected:
         friend class Map;
         friend class ObjectMgr;
@@ -198,6 +206,8 @@ class TerrainInfo : public Referencable<std::atomic_long>
         GridMap* m_GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         bool m_GridMapsLoadAttempted[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         int16 m_GridRef[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        // GridMap published by PrefetchGrid, which holds one grid reference until a first Load or next clean up
+        bool m_GridPrefetched[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
         // global garbage collection timer
         ShortIntervalTimer i_timer;
@@ -223,6 +233,10 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
         void Update(const uint32 diff);
         void UnloadAll();
 
+        // queue background read of terrain data for grid (terrain grid coords), done by a dedicated thread
+        // so the synchronous load at grid enter does not wait on disk
+        void QueueGridPrefetch(const uint32 mapId, const uint32 x, const uint32 y);
+
         uint16 GetAreaFlag(uint32 mapid, float x, float y, float z) const
         {
             TerrainInfo* pData = const_cast<TerrainManager*>(this)->LoadTerrain(mapid);
@@ -254,6 +268,17 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
 
         typedef MaNGOS::ClassLevelLockable<TerrainManager, std::mutex>::Lock Guard;
         TerrainDataMap i_TerrainMap;
+
+        static uint64 MakePrefetchKey(uint32 mapId, uint32 x, uint32 y) { return (uint64(mapId) << 32) | (x << 16) | y; }
+        void PrefetchWorker();
+        void StopGridPrefetch();
+
+        std::thread m_prefetchThread;
+        std::mutex m_prefetchQueueMutex;                    // guards queue and stop flag
+        std::condition_variable m_prefetchCondition;
+        std::deque<uint64> m_prefetchQueue;
+        std::set<uint64> m_prefetchQueued;
+        bool m_prefetchStop;
 };
 
 #define sTerrainMgr TerrainManager::Instance()
@@ -36,6 +36,7 @@
 #include "Server/DBCEnums.h"
 #include "VMapFactory.h"
 #include "MotionGenerators/MoveMap.h"
+#include "Movement/MoveSpline.h"
 #include "Chat/Chat.h"
 #include "Weather/Weather.h"
 #include "AI/ScriptDevAI/ScriptDevAIMgr.h"
@@ -383,6 +384,76 @@ bool Map::EnsureGridLoaded(const Cell& cell)
     return false;
 }
 
+void Map::PredictGridLoads(Player const* player, uint32 lookAhead)
+{
+    // server side splines (flight paths): path points reached within look ahead time
+    if (!player->movespline->Finalized())
+    {
+        Movement::MoveSpline const& moveSpline = *player->movespline;
+        for (int32 idx = moveSpline.GetRawPathIndex() + 1; idx <= moveSpline._Spline().last(); ++idx)
+        {
+            G3D::Vector3 const& point = moveSpline._Spline().getPoint(idx);
+            AddPredictedGrid(point.x, point.y);
+            if (moveSpline.ComputeTimeToIndex(idx) > int32(lookAhead))
+                break;
+        }
+        return;
+    }
+
+    // client controlled movement: straight line along current movement direction
+    if (!player->m_movementInfo.HasMovementFlag(MOVEFLAG_MASK_XY))
+        return;
+
+    float distance = player->GetSpeed(player->m_movementInfo.GetSpeedType()) * lookAhead / IN_MILLISECONDS;
+    float orientation = player->m_movementInfo.GetOrientationInMotion(player->GetOrientation());
+    AddPredictedGrid(player->GetPositionX() + distance * cos(orientation), player->GetPositionY() + distance * sin(orientation));
+}
+
+void Map::AddPredictedGrid(float x, float y)
+{
+    if (!MaNGOS::IsValidMapCoord(x, y))
+        return;
+
+    GridPair p = MaNGOS::ComputeGridPair(x, y);
+    if (loaded(p) || std::find(m_predictedGrids.begin(), m_predictedGrids.end(), p) != m_predictedGrids.end())
+        return;
+
+    m_predictedGrids.push_back(p);
+
+    // z coord
+    int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+    int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+
+    if (!m_bLoadedGrids[gx][gy])
+        sTerrainMgr.QueueGridPrefetch(GetId(), gx, gy);
+}
+
+void Map::LoadPredictedGrids()
+{
+    // grids predicted in previous update, their terrain had time to be prefetched meanwhile
+    uint32 budget = sWorld.getConfig(CONFIG_UINT32_GRID_PRELOAD_MAX_PER_TICK);
+    for (GridPair const& p : m_predictedGrids)
+    {
+        if (!budget)
+            break;
+
+        if (loaded(p))
+            continue;
+
+        Cell cell(CellPair(p.x_coord * MAX_NUMBER_OF_CELLS, p.y_coord * MAX_NUMBER_OF_CELLS));
+        if (EnsureGridLoaded(cell))
+        {
+            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Predicted movement triggers loading of grid [%u,%u] on map %u", cell.GridX(), cell.GridY(), i_id);
+
+            NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
+            ResetGridExpiry(*grid, 0.1f);
+            grid->SetGridState(GRID_STATE_ACTIVE);
+            --budget;
+        }
+    }
+    m_predictedGrids.clear();
+}
+
 uint32 Map::GetLoadedGridsCount()
 {
     uint32 count = 0;
@@ -500,6 +571,7 @@ void Map::MessageBroadcast(Player const* player, WorldPacket const& msg, bool to
     MaNGOS::MessageDeliverer post_man(*player, msg, to_self);
     TypeContainerVisitor<MaNGOS::MessageDeliverer, WorldTypeMapContainer > message(post_man);
     cell.Visit(p, message, *this, *player, player->GetVisibilityData().GetVisibilityDistance());
+    post_man.Deliver();
 }
 
 void Map::MessageBroadcast(WorldObject const* obj, WorldPacket const& msg)
@@ -523,6 +595,7 @@ void Map::MessageBroadcast(WorldObject const* obj, WorldPacket const& msg)
     MaNGOS::ObjectMessageDeliverer post_man(msg);
     TypeContainerVisitor<MaNGOS::ObjectMessageDeliverer, WorldTypeMapContainer > message(post_man);
     cell.Visit(p, message, *this, *obj, obj->GetVisibilityData().GetVisibilityDistance());
+    post_man.Deliver();
 }
 
 void Map::MessageDistBroadcast(Player const* player, WorldPacket const& msg, float dist, bool to_self, bool own_team_only)
@@ -544,6 +617,7 @@ void Map::MessageDistBroadcast(Player const* player, WorldPacket const& msg, flo
     MaNGOS::MessageDistDeliverer post_man(*player, msg, dist, to_self, own_team_only);
     TypeContainerVisitor<MaNGOS::MessageDistDeliverer, WorldTypeMapContainer > message(post_man);
     cell.Visit(p, message, *this, *player, dist);
+    post_man.Deliver();
 }
 
 void Map::MessageDistBroadcast(WorldObject const* obj, WorldPacket const& msg, float dist)
@@ -565,6 +639,7 @@ void Map::MessageDistBroadcast(WorldObject const* obj, WorldPacket const& msg, f
     MaNGOS::ObjectMessageDistDeliverer post_man(*obj, msg, dist);
     TypeContainerVisitor<MaNGOS::ObjectMessageDistDeliverer, WorldTypeMapContainer > message(post_man);
     cell.Visit(p, message, *this, *obj, dist);
+    post_man.Deliver();
 }
 
 void Map::MessageMapBroadcast(WorldObject const* /*obj*/, WorldPacket const& msg)
@@ -677,6 +752,8 @@ void Map::Update(const uint32& t_diff)
 #endif
 
     m_curTime = time(nullptr);
+    m_conditionCache.BeginTick();
+    m_updateLod.Prepare(*this);
 
 #ifdef _MSC_VER
     localtime_s(&m_curTimeTm, &m_curTime);
@@ -690,6 +767,7 @@ void Map::Update(const uint32& t_diff)
 
     GetMessager().Execute(this);
     m_spawnManager.Update();
+    LoadPredictedGrids();
 
     /// update active cells around players and active objects
     resetMarkedCells();
@@ -793,7 +871,8 @@ void Map::Update(const uint32& t_diff)
         botUpdateChance *= 3.0f;
     }
 
-    bool shouldUpdateBots = urand(0, (uint32)(botUpdateChance * 100)) < 100;
+    // level of detail scheduling replaces the random skipping of far bots
+    bool shouldUpdateBots = sWorld.getConfig(CONFIG_BOOL_UPDATE_LOD) || urand(0, (uint32)(botUpdateChance * 100)) < 100;
 #endif
 
     /// update players at tick
@@ -844,10 +923,14 @@ void Map::Update(const uint32& t_diff)
             }
 #endif
 
-            plr->Update(t_diff);
+            uint32 plrDiff;
+            if (!m_updateLod.IsDue(*plr, t_diff, plrDiff))
+                continue;
+
+            plr->Update(plrDiff);
 
 #ifdef ENABLE_PLAYERBOTS
-            plr->UpdateAI(t_diff, !shouldUpdateBot);
+            plr->UpdateAI(plrDiff, !shouldUpdateBot);
 #endif
         }
     }
@@ -861,6 +944,7 @@ void Map::Update(const uint32& t_diff)
     }
 #endif
 
+    uint32 gridPreloadLookAhead = sWorld.getConfig(CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD);
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* player = m_mapRefIter->getSource();
@@ -891,6 +975,9 @@ void Map::Update(const uint32& t_diff)
 
         VisitNearbyCellsOf(player, grid_object_update, world_object_update);
 
+        if (gridPreloadLookAhead)
+            PredictGridLoads(player, gridPreloadLookAhead);
+
         // If player is using far sight, visit that object too
         if (WorldObject* viewPoint = GetWorldObject(player->GetFarSightGuid()))
             VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
@@ -906,7 +993,7 @@ void Map::Update(const uint32& t_diff)
         objectUpdateChance *= 3.0f;
     }
 
-    const bool shouldUpdateObjects = urand(0, (uint32)(objectUpdateChance * 100)) < 100;
+    const bool shouldUpdateObjects = sWorld.getConfig(CONFIG_BOOL_UPDATE_LOD) || urand(0, (uint32)(objectUpdateChance * 100)) < 100;
 #endif
 
     // non-player active objects
@@ -962,17 +1049,16 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
-    // update all objects
-    for (auto wObj : objToUpdate)
-    {
-        wObj->Update(t_diff);
-        ++count;
-    }
+    // update all objects, far from real players less often
+    count += m_updateLod.UpdateObjects(objToUpdate, t_diff);
 
 #ifdef BUILD_METRICS
     meas.add_field("count", std::to_string(static_cast<int32>(count)));
+    meas.add_field("lod_skipped", std::to_string(static_cast<int32>(m_updateLod.GetAndResetSkipped())));
 #endif
 
+    m_movementRelay.Update(*this, t_diff);
+
     // Send world objects and item update field changes
     SendObjectUpdates();
 
@@ -991,17 +1077,36 @@ void Map::Update(const uint32& t_diff)
     }
 
     ///- Process necessary scripts
-    if (!m_scriptSchedule.empty())
+    if (!m_scriptScheduler.IsEmpty())
         ScriptsProcess();
 
+#ifdef BUILD_METRICS
+    ScriptSchedulerStats const scriptStats = m_scriptScheduler.GetAndResetStats();
+    if (scriptStats.scheduled || scriptStats.executed)
+    {
+        metric::measurement scripts_meas("map.scripts", {
+            { "map_id", std::to_string(i_id) },
+            { "instance_id", std::to_string(i_InstanceId) }
+        });
+        scripts_meas.add_field("scheduled", std::to_string(scriptStats.scheduled));
+        scripts_meas.add_field("executed", std::to_string(scriptStats.executed));
+        scripts_meas.add_field("terminated", std::to_string(scriptStats.terminated));
+        scripts_meas.add_field("queued", std::to_string(m_scriptScheduler.GetQueuedCount()));
+    }
+#endif
+
     if (i_data)
         i_data->Update(t_diff);
 
     m_weatherSystem->UpdateWeathers(t_diff);
+
+    m_conditionCache.EndTick();
 }
 
 void Map::Remove(Player* player, bool remove)
 {
+    m_movementRelay.Discard(player->GetObjectGuid());
+
     if (i_data)
         i_data->OnPlayerLeave(player);
 
@@ -2141,15 +2246,12 @@ bool Map::ScriptsStart(ScriptMapType scriptType, uint32 id, Object* source, Obje
 
     if (execParams)                                         // Check if the execution should be uniquely
     {
-        for (ScriptScheduleMap::const_iterator searchItr = m_scriptSchedule.begin(); searchItr != m_scriptSchedule.end(); ++searchItr)
+        if (m_scriptScheduler.HasScript(scriptMapMap->first, id,
+                                        execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE ? sourceGuid : ObjectGuid(),
+                                        execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET ? targetGuid : ObjectGuid(), ownerGuid))
         {
-            if (searchItr->second.IsSameScript(scriptMapMap->first, id,
-                                               execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE ? sourceGuid : ObjectGuid(),
-                                               execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET ? targetGuid : ObjectGuid(), ownerGuid))
-            {
-                DETAIL_FILTER_LOG(LOG_FILTER_DB_SCRIPT, "DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", scriptMapMap->first, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
-                return true;
-            }
+            DETAIL_FILTER_LOG(LOG_FILTER_DB_SCRIPT, "DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", scriptMapMap->first, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
+            return true;
         }
     }
 
@@ -2177,7 +2279,7 @@ bool Map::ScriptsStart(ScriptMapType scriptType, uint32 id, Object* source, Obje
     {
         auto const& scriptInfo = scriptInfoItr->second;
         ScriptAction sa(scriptType, this, sourceGuid, targetGuid, ownerGuid, scriptInfo);
-        m_scriptSchedule.emplace(GetCurrentClockTime() + std::chrono::milliseconds(scriptInfoItr->first), sa);
+        m_scriptScheduler.Schedule(GetCurrentClockTime(), scriptInfoItr->first, sa);
     }
 
     return true;
@@ -2195,9 +2297,7 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
     ScriptAction sa(SCRIPT_TYPE_INTERNAL, this, sourceGuid, targetGuid, ownerGuid, std::make_shared<ScriptInfo>(script));
 
     if (delay)
-    {
-        m_scriptSchedule.emplace(GetCurrentClockTime() + std::chrono::milliseconds(delay), sa);
-    }
+        m_scriptScheduler.Schedule(GetCurrentClockTime(), delay, sa);
     else
         sa.HandleScriptStep();
 }
@@ -2205,36 +2305,7 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
 /// Process queued scripts
 void Map::ScriptsProcess()
 {
-    if (m_scriptSchedule.empty())
-        return;
-
-    ///- Process overdue queued scripts
-    ScriptScheduleMap::iterator iter = m_scriptSchedule.begin();
-    // ok as multimap is a *sorted* associative container
-    while (!m_scriptSchedule.empty() && (iter->first <= GetCurrentClockTime()))
-    {
-        if (iter->second.HandleScriptStep())
-        {
-            // Terminate following script steps of this script
-            const char* tableName = iter->second.GetTableName();
-            uint32 id = iter->second.GetId();
-            ObjectGuid sourceGuid = iter->second.GetSourceGuid();
-            ObjectGuid targetGuid = iter->second.GetTargetGuid();
-            ObjectGuid ownerGuid = iter->second.GetOwnerGuid();
-
-            for (ScriptScheduleMap::iterator rmItr = m_scriptSchedule.begin(); rmItr != m_scriptSchedule.end();)
-            {
-                if (rmItr->second.IsSameScript(tableName, id, sourceGuid, targetGuid, ownerGuid))
-                    m_scriptSchedule.erase(rmItr++);
-                else
-                    ++rmItr;
-            }
-        }
-        else
-            m_scriptSchedule.erase(iter);
-
-        iter = m_scriptSchedule.begin();
-    }
+    m_scriptScheduler.Process(GetCurrentClockTime());
 }
 
 /**
@@ -2386,7 +2457,7 @@ void Map::SendObjectUpdates()
 
 Creature* Map::GetCreature(uint32 dbguid) const
 {
-    auto itr = m_dbGuidObjects.find(std::make_pair(HIGHGUID_UNIT, dbguid));
+    auto itr = m_dbGuidObjects.find(DbGuidObjectKey(HIGHGUID_UNIT, dbguid));
     if (itr == m_dbGuidObjects.end())
         return nullptr;
 
@@ -2403,7 +2474,7 @@ Creature* Map::GetCreature(uint32 dbguid) const
 
 GameObject* Map::GetGameObject(uint32 dbguid) const
 {
-    auto itr = m_dbGuidObjects.find(std::make_pair(HIGHGUID_GAMEOBJECT, dbguid));
+    auto itr = m_dbGuidObjects.find(DbGuidObjectKey(HIGHGUID_GAMEOBJECT, dbguid));
     if (itr == m_dbGuidObjects.end())
         return nullptr;
 
@@ -2475,12 +2546,12 @@ GameObject* Map::GetGameObject(std::string stringId) const
 
 void Map::AddDbGuidObject(WorldObject* obj)
 {
-    m_dbGuidObjects[std::make_pair(HighGuid(obj->GetParentHigh()), obj->GetDbGuid())].push_back(obj);
+    m_dbGuidObjects[DbGuidObjectKey(HighGuid(obj->GetParentHigh()), obj->GetDbGuid())].push_back(obj);
 }
 
 void Map::RemoveDbGuidObject(WorldObject* obj)
 {
-    auto& vec = m_dbGuidObjects[std::make_pair(HighGuid(obj->GetParentHigh()), obj->GetDbGuid())];
+    auto& vec = m_dbGuidObjects[DbGuidObjectKey(HighGuid(obj->GetParentHigh()), obj->GetDbGuid())];
     vec.erase(std::remove(vec.begin(), vec.end(), obj), vec.end());
 }
 
@@ -32,13 +32,17 @@
 #include "GameSystem/GridRefManager.h"
 #include "MapRefManager.h"
 #include "DBScripts/ScriptMgr.h"
+#include "DBScripts/ScriptScheduler.h"
+#include "Maps/UpdateLodScheduler.h"
 #include "Entities/CreatureLinkingMgr.h"
 #include "vmap/DynamicTree.h"
 #include "Multithreading/Messager.h"
 #include "Globals/GraveyardManager.h"
 #include "Maps/SpawnManager.h"
+#include "Maps/MovementRelay.h"
 #include "Maps/MapDataContainer.h"
 #include "World/WorldStateVariableManager.h"
+#include "Globals/Conditions.h"
 
 #include <bitset>
 #include <functional>
@@ -365,10 +369,13 @@ class Map : public GridRefManager<NGridType>
 
         SpawnManager& GetSpawnManager() { return m_spawnManager; }
 
+        MovementRelay& GetMovementRelay() { return m_movementRelay; }
+
         MapDataContainer& GetMapDataContainer() { return m_dataContainer; }
         MapDataContainer const& GetMapDataContainer() const { return m_dataContainer; }
         WorldStateVariableManager& GetVariableManager() { return m_variableManager; }
         WorldStateVariableManager const& GetVariableManager() const { return m_variableManager; }
+        ConditionCache& GetConditionCache() const { return m_conditionCache; }
 
         // debug
         std::set<ObjectGuid> m_objRemoveList; // this will eventually eat up too much memory - only used for debugging VisibleNotifier::Notify() customlog leak
@@ -394,6 +401,11 @@ class Map : public GridRefManager<NGridType>
 
         bool loaded(const GridPair&) const;
         void EnsureGridCreated(const GridPair&);
+
+        // grids on the predicted path of players, see GridPreload.* config options
+        void PredictGridLoads(Player const* player, uint32 lookAhead);
+        void AddPredictedGrid(float x, float y);
+        void LoadPredictedGrids();
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedAtEnter(Cell const&, Player* player = nullptr);
 
@@ -432,7 +444,8 @@ class Map : public GridRefManager<NGridType>
         MapStoredObjectTypesContainer m_objectsStore;
         std::map<uint32, uint32> m_tempCreatures;
         std::map<uint32, uint32> m_tempPets;
-        std::map<std::pair<HighGuid, uint32>, std::vector<WorldObject*>> m_dbGuidObjects;
+        static uint64 DbGuidObjectKey(HighGuid high, uint32 dbguid) { return (uint64(high) << 32) | dbguid; }
+        MaNGOS::OpenHashMap<uint64, std::vector<WorldObject*>> m_dbGuidObjects;
 
         WorldObjectSet m_onEventNotifiedObjects;
         WorldObjectSet::iterator m_onEventNotifiedIter;
@@ -450,13 +463,14 @@ class Map : public GridRefManager<NGridType>
         // Shared geodata object with map coord info...
         TerrainInfo* const m_TerrainData;
         bool m_bLoadedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        std::vector<GridPair> m_predictedGrids;             // filled each update, objects loaded in next one within budget
 
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
         WorldObjectSet i_objectsToRemove;
 
-        typedef std::multimap<TimePoint, ScriptAction> ScriptScheduleMap;
-        ScriptScheduleMap m_scriptSchedule;
+        ScriptScheduler m_scriptScheduler;
+        UpdateLodScheduler m_updateLod;
 
         InstanceData* i_data;
         uint32 i_script_id;
@@ -492,6 +506,9 @@ class Map : public GridRefManager<NGridType>
         // spawning
         SpawnManager m_spawnManager;
 
+        // client movement broadcast, see Visibility.MovementRelay* config options
+        MovementRelay m_movementRelay;
+
         struct StringIdMapStorage
         {
             std::vector<WorldObject*> worldObjects;
@@ -506,6 +523,9 @@ class Map : public GridRefManager<NGridType>
 
         WorldStateVariableManager m_variableManager;
 
+        // memoized condition results, reset every tick
+        mutable ConditionCache m_conditionCache;
+
 #ifdef ENABLE_PLAYERBOTS
         std::vector<uint32> m_activeZones;
         uint32 m_activeZonesTimer;
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/MovementRelay.h"
+#include "Maps/Map.h"
+#include "Entities/Player.h"
+#include "World/World.h"
+
+#include <atomic>
+
+namespace
+{
+    // shared by all maps, updated from map threads
+    std::atomic<uint64> s_queued(0);
+    std::atomic<uint64> s_coalesced(0);
+    std::atomic<uint64> s_sent(0);
+}
+
+bool MovementRelay::IsStateOnlyOpcode(uint16 opcode)
+{
+    switch (opcode)
+    {
+        case MSG_MOVE_HEARTBEAT:
+        case MSG_MOVE_SET_FACING:
+        case MSG_MOVE_SET_PITCH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void MovementRelay::Relay(Unit* mover, Player const* sender, WorldPacket& data)
+{
+    if (!sWorld.getConfig(CONFIG_BOOL_MOVEMENT_RELAY) || !IsStateOnlyOpcode(data.GetOpcode()))
+    {
+        Send(mover, sender, data);
+        return;
+    }
+
+    ++s_queued;
+
+    ObjectGuid const& moverGuid = mover->GetObjectGuid();
+    ObjectGuid const senderGuid = sender ? sender->GetObjectGuid() : ObjectGuid();
+
+    auto itr = m_pendingIndex.find(moverGuid);
+    if (itr != m_pendingIndex.end())
+    {
+        // the stored state is outdated, observers only get the newest one
+        PendingMovement& pending = m_pending[itr->second];
+        pending.sender = senderGuid;
+        pending.data = std::move(data);
+        ++s_coalesced;
+        return;
+    }
+
+    m_pendingIndex.emplace(moverGuid, m_pending.size());
+    m_pending.push_back({ moverGuid, senderGuid, std::move(data) });
+}
+
+void MovementRelay::Send(Unit* mover, Player const* sender, WorldPacket const& data)
+{
+    // keep order of movement packets of the mover
+    auto itr = m_pendingIndex.find(mover->GetObjectGuid());
+    if (itr != m_pendingIndex.end())
+    {
+        mover->SendMessageToSetExcept(m_pending[itr->second].data, sender);
+        ++s_sent;
+        Erase(itr);
+    }
+
+    mover->SendMessageToSetExcept(data, sender);
+}
+
+void MovementRelay::Discard(ObjectGuid const& moverGuid)
+{
+    auto itr = m_pendingIndex.find(moverGuid);
+    if (itr != m_pendingIndex.end())
+        Erase(itr);
+}
+
+void MovementRelay::Erase(PendingIndex::iterator itr)
+{
+    size_t const index = itr->second;
+    m_pendingIndex.erase(itr);
+    if (index + 1 != m_pending.size())
+    {
+        m_pending[index] = std::move(m_pending.back());
+        m_pendingIndex[m_pending[index].mover] = index;
+    }
+    m_pending.pop_back();
+}
+
+void MovementRelay::Update(Map& map, uint32 diff)
+{
+    if (m_pending.empty())
+    {
+        m_timer = 0;
+        return;
+    }
+
+    m_timer += diff;
+    if (m_timer < sWorld.getConfig(CONFIG_UINT32_MOVEMENT_RELAY_INTERVAL))
+        return;
+
+    m_timer = 0;
+    Flush(map);
+}
+
+void MovementRelay::Flush(Map& map)
+{
+    for (PendingMovement const& pending : m_pending)
+    {
+        // mover may have left the map since, its observers got it removed then
+        Unit* mover = map.GetUnit(pending.mover);
+        if (!mover || !mover->IsInWorld())
+            continue;
+
+        mover->SendMessageToSetExcept(pending.data, map.GetPlayer(pending.sender));
+        ++s_sent;
+    }
+
+    m_pending.clear();
+    m_pendingIndex.clear();
+}
+
+MovementRelayStats MovementRelay::GetAndResetStats()
+{
+    MovementRelayStats stats;
+    stats.queued = s_queued.exchange(0);
+    stats.coalesced = s_coalesced.exchange(0);
+    stats.sent = s_sent.exchange(0);
+    return stats;
+}
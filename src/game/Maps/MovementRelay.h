@@ -0,0 +1,84 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_MOVEMENTRELAY_H
+#define MANGOS_MOVEMENTRELAY_H
+
+#include "Common.h"
+#include "Entities/ObjectGuid.h"
+#include "Server/WorldPacket.h"
+
+#include <unordered_map>
+#include <vector>
+
+class Map;
+class Unit;
+class Player;
+
+struct MovementRelayStats
+{
+    uint64 queued;                                          // state only packets stored for delayed relay
+    uint64 coalesced;                                       // stored packets replaced by a newer state of same mover, never sent
+    uint64 sent;                                            // stored packets broadcast to observers
+};
+
+/*
+  @class MovementRelay
+  Map local relay of client movement packets to observers. Packets only carrying the current state of a
+  mover (heartbeats, facing and pitch updates) are stored per mover and broadcast at the relay interval,
+  a newer state replacing the stored one. Any other movement packet of the mover is sent at once, after
+  the stored state, so observers always see the movement of a mover in order.
+ */
+class MovementRelay
+{
+    public:
+        MovementRelay() : m_timer(0) {}
+
+        // broadcast data to observers of mover except sender, delayed and coalesced if it is a state only packet
+        void Relay(Unit* mover, Player const* sender, WorldPacket& data);
+
+        // drop the stored state of mover, for server side position changes (teleports)
+        void Discard(ObjectGuid const& moverGuid);
+
+        void Update(Map& map, uint32 diff);
+
+        static bool IsStateOnlyOpcode(uint16 opcode);
+
+        // counters since the previous call
+        static MovementRelayStats GetAndResetStats();
+
+    private:
+        struct PendingMovement
+        {
+            ObjectGuid mover;
+            ObjectGuid sender;
+            WorldPacket data;
+        };
+
+        typedef std::unordered_map<ObjectGuid, size_t> PendingIndex;
+
+        void Send(Unit* mover, Player const* sender, WorldPacket const& data);
+        void Erase(PendingIndex::iterator itr);
+        void Flush(Map& map);
+
+        std::vector<PendingMovement> m_pending;
+        PendingIndex m_pendingIndex;                        // mover guid -> index in m_pending
+        uint32 m_timer;
+};
+
+#endif
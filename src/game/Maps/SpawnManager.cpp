@@ -108,102 +108,130 @@ void SpawnManager::Initialize()
 void SpawnManager::AddCreature(uint32 dbguid)
 {
     time_t respawnTime = m_map.GetPersistentState()->GetCreatureRespawnTime(dbguid);
-    if (m_updated)
-        m_deferredSpawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_UNIT);
-    else
-        m_spawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_UNIT);
+    AddSpawn(SpawnInfo(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_UNIT));
 }
 
 void SpawnManager::AddGameObject(uint32 dbguid)
 {
     time_t respawnTime = m_map.GetPersistentState()->GetGORespawnTime(dbguid);
-    if (m_updated)
-        m_deferredSpawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_GAMEOBJECT);
-    else
-        m_spawns.emplace_back(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_GAMEOBJECT);
+    AddSpawn(SpawnInfo(TimePoint(std::chrono::seconds(respawnTime)), dbguid, HIGHGUID_GAMEOBJECT));
 }
 
-void SpawnManager::RespawnCreature(uint32 dbguid, uint32 respawnDelay)
+void SpawnManager::AddSpawn(SpawnInfo const& spawnInfo)
 {
-    bool found = false;
-    auto itr = m_spawns.begin();
-    for (; itr != m_spawns.end(); )
+    if (m_updated)
     {
-        auto& spawnInfo = *itr;
-        if (!spawnInfo.IsUsed() && spawnInfo.GetDbGuid() == dbguid && spawnInfo.GetHighGuid() == HIGHGUID_UNIT)
-        {
-            found = true;
-            m_map.GetPersistentState()->SaveCreatureRespawnTime(dbguid, time(nullptr) + respawnDelay);
-            if (respawnDelay > 0)
-                spawnInfo.SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
-            break;
-        }
-        ++itr;
+        m_deferredSpawns.push_back(spawnInfo);
+        return;
     }
-    if (!found)
+
+    // entry currently constructing, replacing it now would lose the new one when construction finishes
+    auto itr = m_spawns.find(MakeSpawnKey(spawnInfo.GetDbGuid(), spawnInfo.GetHighGuid()));
+    if (itr != m_spawns.end() && itr->second.IsInUse())
     {
-        m_map.GetPersistentState()->SaveCreatureRespawnTime(dbguid, time(nullptr) + respawnDelay);
-        AddCreature(dbguid);
+        m_deferredSpawns.push_back(spawnInfo);
+        return;
     }
-    else if (respawnDelay == 0)
-        (*itr).ConstructForMap(m_map);
+
+    InsertSpawn(spawnInfo);
 }
 
-void SpawnManager::RespawnGameObject(uint32 dbguid, uint32 respawnDelay)
+void SpawnManager::InsertSpawn(SpawnInfo const& spawnInfo)
 {
-    bool found = false;
-    auto itr = m_spawns.begin();
-    for (; itr != m_spawns.end(); )
+    auto result = m_spawns.emplace(MakeSpawnKey(spawnInfo.GetDbGuid(), spawnInfo.GetHighGuid()), spawnInfo);
+    if (result.second)
+        ModifyPendingCount(spawnInfo.GetHighGuid(), 1);
+    else
     {
-        auto& spawnInfo = *itr;
-        if (!spawnInfo.IsUsed() && spawnInfo.GetDbGuid() == dbguid && spawnInfo.GetHighGuid() == HIGHGUID_GAMEOBJECT)
+        SpawnInfo& existing = result.first->second;
+        if (existing.IsUsed()) // already spawned or removed, awaiting erase in Update
         {
-            found = true;
-            m_map.GetPersistentState()->SaveGORespawnTime(dbguid, time(nullptr) + respawnDelay);
-            if (respawnDelay > 0)
-                spawnInfo.SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
-            break;
+            existing = spawnInfo;
+            ModifyPendingCount(spawnInfo.GetHighGuid(), 1);
         }
-        ++itr;
+        else
+            existing.SetRespawnTime(spawnInfo.GetRespawnTime());
     }
-    if (!found)
+    ScheduleSpawn(spawnInfo);
+}
+
+SpawnInfo* SpawnManager::FindPendingSpawn(uint32 dbguid, HighGuid high)
+{
+    auto itr = m_spawns.find(MakeSpawnKey(dbguid, high));
+    if (itr == m_spawns.end() || itr->second.IsUsed())
+        return nullptr;
+    return &itr->second;
+}
+
+bool SpawnManager::ConstructSpawn(SpawnInfo& spawnInfo)
+{
+    if (!spawnInfo.ConstructForMap(m_map))
+        return false;
+
+    ModifyPendingCount(spawnInfo.GetHighGuid(), -1);
+    return true;
+}
+
+void SpawnManager::SetSpawnUsed(SpawnInfo& spawnInfo)
+{
+    if (spawnInfo.IsUsed())
+        return;
+
+    spawnInfo.SetUsed(); // will be erased when its respawn time is reached in Update
+    ModifyPendingCount(spawnInfo.GetHighGuid(), -1);
+}
+
+void SpawnManager::ModifyPendingCount(HighGuid high, int32 diff)
+{
+    uint32& counter = high == HIGHGUID_UNIT ? m_pendingCreatureRespawns : m_pendingGoRespawns;
+    counter = uint32(int32(counter) + diff);
+}
+
+void SpawnManager::RespawnCreature(uint32 dbguid, uint32 respawnDelay)
+{
+    m_map.GetPersistentState()->SaveCreatureRespawnTime(dbguid, time(nullptr) + respawnDelay);
+    SpawnInfo* spawnInfo = FindPendingSpawn(dbguid, HIGHGUID_UNIT);
+    if (!spawnInfo)
+        AddCreature(dbguid);
+    else if (respawnDelay == 0)
+        ConstructSpawn(*spawnInfo);
+    else
     {
-        m_map.GetPersistentState()->SaveGORespawnTime(dbguid, time(nullptr) + respawnDelay);
-        AddGameObject(dbguid);
+        spawnInfo->SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
+        ScheduleSpawn(*spawnInfo);
     }
-    else if (respawnDelay == 0)
-        (*itr).ConstructForMap(m_map);
 }
 
-void SpawnManager::RemoveSpawns(std::vector<uint32> const& creatureDbGuids, std::vector<uint32> const& goDbGuids)
+void SpawnManager::RespawnGameObject(uint32 dbguid, uint32 respawnDelay)
 {
-    for (auto& spawnInfo : m_spawns)
+    m_map.GetPersistentState()->SaveGORespawnTime(dbguid, time(nullptr) + respawnDelay);
+    SpawnInfo* spawnInfo = FindPendingSpawn(dbguid, HIGHGUID_GAMEOBJECT);
+    if (!spawnInfo)
+        AddGameObject(dbguid);
+    else if (respawnDelay == 0)
+        ConstructSpawn(*spawnInfo);
+    else
     {
-        switch (spawnInfo.GetHighGuid())
-        {
-            case HIGHGUID_GAMEOBJECT:
-                if (std::find(goDbGuids.begin(), goDbGuids.end(), spawnInfo.GetDbGuid()) != goDbGuids.end())
-                    spawnInfo.SetUsed(); // will be erased on next manager update
-                break;
-            case HIGHGUID_UNIT:
-                if (std::find(creatureDbGuids.begin(), creatureDbGuids.end(), spawnInfo.GetDbGuid()) != creatureDbGuids.end())
-                    spawnInfo.SetUsed(); // will be erased on next manager update
-                break;
-            default: break;
-        }
+        spawnInfo->SetRespawnTime(m_map.GetCurrentClockTime() + std::chrono::seconds(respawnDelay));
+        ScheduleSpawn(*spawnInfo);
     }
 }
 
+void SpawnManager::RemoveSpawns(std::vector<uint32> const& creatureDbGuids, std::vector<uint32> const& goDbGuids)
+{
+    for (uint32 dbguid : creatureDbGuids)
+        if (SpawnInfo* spawnInfo = FindPendingSpawn(dbguid, HIGHGUID_UNIT))
+            SetSpawnUsed(*spawnInfo);
+
+    for (uint32 dbguid : goDbGuids)
+        if (SpawnInfo* spawnInfo = FindPendingSpawn(dbguid, HIGHGUID_GAMEOBJECT))
+            SetSpawnUsed(*spawnInfo);
+}
+
 void SpawnManager::RemoveSpawn(uint32 dbguid, HighGuid high)
 {
-    for (auto& spawnInfo : m_spawns)
-    {
-        if (spawnInfo.GetHighGuid() == high && spawnInfo.GetDbGuid() == dbguid)
-        {
-            spawnInfo.SetUsed(); // will be erased on next manager update
-            break;
-        }
-    }
+    if (SpawnInfo* spawnInfo = FindPendingSpawn(dbguid, high))
+        SetSpawnUsed(*spawnInfo);
 }
 
 void SpawnManager::AddEventGuid(uint32 dbguid, HighGuid high)
@@ -239,36 +267,53 @@ bool SpawnManager::IsEventGuid(uint32 dbguid, HighGuid high) const
 
 void SpawnManager::RespawnAll()
 {
-    for (auto itr = m_spawns.begin(); itr != m_spawns.end();)
+    bool updated = m_updated;
+    m_updated = true; // spawns added by the constructed objects must not rehash m_spawns while iterating
+    for (auto& spawnData : m_spawns)
     {
-        auto& spawnInfo = *itr;
+        SpawnInfo& spawnInfo = spawnData.second;
+        if (spawnInfo.IsUsed())
+            continue;
         if (spawnInfo.GetHighGuid() == HIGHGUID_GAMEOBJECT)
             m_map.GetPersistentState()->SaveGORespawnTime(spawnInfo.GetDbGuid(), 0);
         if (spawnInfo.GetHighGuid() == HIGHGUID_UNIT)
             m_map.GetPersistentState()->SaveCreatureRespawnTime(spawnInfo.GetDbGuid(), 0);
-        spawnInfo.ConstructForMap(m_map);
+        ConstructSpawn(spawnInfo);
     }
+    m_updated = updated;
 }
 
 void SpawnManager::Update()
 {
     m_updated = true;
-    if (!m_deferredSpawns.empty()) // cannot insert during update
-    {
-        m_spawns.reserve(m_spawns.size() + m_spawns.size());
-        std::move(std::begin(m_deferredSpawns), std::end(m_deferredSpawns), std::back_inserter(m_deferredSpawns));
-        m_deferredSpawns.clear();
-    }
+    for (SpawnInfo const& spawnInfo : m_deferredSpawns) // cannot insert during update
+        InsertSpawn(spawnInfo);
+    m_deferredSpawns.clear();
+
+    // only due entries are touched, failed constructions are retried next update
     auto now = m_map.GetCurrentClockTime();
-    for (auto itr = m_spawns.begin(); itr != m_spawns.end();)
+    std::vector<RespawnQueueEntry> retries;
+    while (!m_respawnQueue.empty() && m_respawnQueue.top().respawnTime <= now)
     {
-        auto& spawnInfo = *itr;
-        if (spawnInfo.IsUsed() ||
-            (spawnInfo.GetRespawnTime() <= now && spawnInfo.ConstructForMap(m_map)))
-            itr = m_spawns.erase(itr);
+        RespawnQueueEntry entry = m_respawnQueue.top();
+        m_respawnQueue.pop();
+
+        auto itr = m_spawns.find(entry.spawnKey);
+        if (itr == m_spawns.end())
+            continue;
+
+        SpawnInfo& spawnInfo = itr->second;
+        if (spawnInfo.IsUsed())
+            m_spawns.erase(itr);
+        else if (spawnInfo.GetRespawnTime() != entry.respawnTime) // rescheduled, has its own queue entry
+            continue;
+        else if (ConstructSpawn(spawnInfo))
+            m_spawns.erase(itr);
         else
-            ++itr;
+            retries.push_back(entry);
     }
+    for (RespawnQueueEntry const& entry : retries)
+        m_respawnQueue.push(entry);
     m_updated = false;
 
     // spawn groups are safe from this
@@ -278,11 +323,18 @@ void SpawnManager::Update()
 
 std::string SpawnManager::GetRespawnList()
 {
-    std::string output = "";
-    for (auto& data : m_spawns)
+    std::vector<SpawnInfo const*> pending;
+    pending.reserve(m_spawns.size());
+    for (auto& spawnData : m_spawns)
+        if (!spawnData.second.IsUsed())
+            pending.push_back(&spawnData.second);
+    std::sort(pending.begin(), pending.end(), [](SpawnInfo const* lhs, SpawnInfo const* rhs) { return *lhs < *rhs; });
+
+    std::string output = "Pending respawns: " + std::to_string(m_pendingCreatureRespawns) + " creatures, " + std::to_string(m_pendingGoRespawns) + " gameobjects\n";
+    for (SpawnInfo const* data : pending)
     {
-        output += "DBGuid: " + std::to_string(data.GetDbGuid()) + "HighGuid: " + (data.GetHighGuid() == HIGHGUID_UNIT ? "Creature" : "GameObject") + "Respawn Time ";
-        auto diff = (data.GetRespawnTime() - m_map.GetCurrentClockTime()).count();
+        output += "DBGuid: " + std::to_string(data->GetDbGuid()) + "HighGuid: " + (data->GetHighGuid() == HIGHGUID_UNIT ? "Creature" : "GameObject") + "Respawn Time ";
+        auto diff = (data->GetRespawnTime() - m_map.GetCurrentClockTime()).count();
         if (auto hours = diff / (HOUR * IN_MILLISECONDS))
         {
             output += std::to_string(hours) + "h ";
@@ -24,6 +24,7 @@
 #include "Maps/SpawnGroup.h"
 
 #include <string>
+#include <queue>
 
 class Map;
 
@@ -38,6 +39,7 @@ class SpawnInfo
         HighGuid GetHighGuid() const { return m_high; }
         void SetUsed() { m_used = true; }
         bool IsUsed() const { return m_inUse || m_used; }
+        bool IsInUse() const { return m_inUse; }
     private:
         TimePoint m_respawnTime;
         uint32 m_dbguid;
@@ -51,7 +53,7 @@ bool operator<(SpawnInfo const& lhs, SpawnInfo const& rhs);
 class SpawnManager
 {
     public:
-        SpawnManager(Map& map) : m_map(map), m_updated(false) {}
+        SpawnManager(Map& map) : m_map(map), m_updated(false), m_pendingCreatureRespawns(0), m_pendingGoRespawns(0) {}
         ~SpawnManager();
         void Initialize();
 
@@ -74,18 +76,47 @@ class SpawnManager
         void Update();
 
         std::string GetRespawnList();
+        uint32 GetPendingRespawnCount(HighGuid high) const { return high == HIGHGUID_UNIT ? m_pendingCreatureRespawns : m_pendingGoRespawns; }
 
         SpawnGroup* GetSpawnGroup(uint32 Id);
 
         void RespawnSpawnGroupsInVicinity(Position pos, float range);
     private:
+        // respawn queue entry, stale when the spawn was rescheduled or removed meanwhile
+        struct RespawnQueueEntry
+        {
+            RespawnQueueEntry(TimePoint when, uint64 key) : respawnTime(when), spawnKey(key) {}
+            TimePoint respawnTime;
+            uint64 spawnKey;
+        };
+        struct RespawnQueueOrder
+        {
+            bool operator()(RespawnQueueEntry const& lhs, RespawnQueueEntry const& rhs) const { return lhs.respawnTime > rhs.respawnTime; }
+        };
+        typedef std::priority_queue<RespawnQueueEntry, std::vector<RespawnQueueEntry>, RespawnQueueOrder> RespawnQueue;
+        typedef std::unordered_map<uint64, SpawnInfo> SpawnInfoMap;
+
+        static uint64 MakeSpawnKey(uint32 dbguid, HighGuid high) { return (uint64(high) << 32) | dbguid; }
+
+        void AddSpawn(SpawnInfo const& spawnInfo);
+        void InsertSpawn(SpawnInfo const& spawnInfo);
+        SpawnInfo* FindPendingSpawn(uint32 dbguid, HighGuid high);
+        void ScheduleSpawn(SpawnInfo const& spawnInfo) { m_respawnQueue.emplace(spawnInfo.GetRespawnTime(), MakeSpawnKey(spawnInfo.GetDbGuid(), spawnInfo.GetHighGuid())); }
+        bool ConstructSpawn(SpawnInfo& spawnInfo);
+        void SetSpawnUsed(SpawnInfo& spawnInfo);
+        void ModifyPendingCount(HighGuid high, int32 diff);
+
         Map& m_map;
 
         std::vector<SpawnInfo> m_deferredSpawns;
-        std::vector<SpawnInfo> m_spawns; // must only be erased from in Update
+        SpawnInfoMap m_spawns;                              // must only be erased from in Update
+        RespawnQueue m_respawnQueue;                        // earliest respawn on top
         std::map<uint32, SpawnGroup*> m_spawnGroups;
         bool m_updated;
 
+        uint32 m_pendingCreatureRespawns;
+        uint32 m_pendingGoRespawns;
+
         std::set<uint32> m_eventCreatureDbGuids;
         std::set<uint32> m_eventGoDbGuids;
 };
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/UpdateLodScheduler.h"
+#include "Maps/Map.h"
+#include "Maps/GridDefines.h"
+#include "Entities/Player.h"
+#include "Groups/Group.h"
+#include "World/World.h"
+
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
+
+bool UpdateLodScheduler::IsRealPlayer(Player* player)
+{
+#if defined(ENABLE_PLAYERBOTS)
+    return player->isRealPlayer();
+#elif defined(BUILD_DEPRECATED_PLAYERBOT)
+    return !player->GetPlayerbotAI();
+#else
+    return true;
+#endif
+}
+
+void UpdateLodScheduler::Prepare(Map& map)
+{
+    ++m_tick;
+
+    m_enabled = sWorld.getConfig(CONFIG_BOOL_UPDATE_LOD);
+    if (!m_enabled)
+        return;
+
+    m_tierDistance = float(sWorld.getConfig(CONFIG_UINT32_UPDATE_LOD_DISTANCE));
+    m_maxTier = sWorld.getConfig(CONFIG_UINT32_UPDATE_LOD_MAX_TIER);
+
+    m_realPlayerX.clear();
+    m_realPlayerY.clear();
+    m_cellTiers.clear();
+
+    for (auto& ref : map.GetPlayers())
+    {
+        Player* player = ref.getSource();
+        if (player && player->IsInWorld() && IsRealPlayer(player))
+        {
+            m_realPlayerX.push_back(player->GetPositionX());
+            m_realPlayerY.push_back(player->GetPositionY());
+        }
+    }
+}
+
+uint32 UpdateLodScheduler::GetCellTier(float x, float y)
+{
+    CellPair const cellPair = MaNGOS::ComputeCellPair(x, y);
+    uint32 const cellId = cellPair.y_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP + cellPair.x_coord;
+
+    auto itr = m_cellTiers.find(cellId);
+    if (itr != m_cellTiers.end())
+        return itr->second;
+
+    // distance from the cell center, less half the cell diagonal so no object of the cell gets a too high tier
+    float const centerX = (int32(cellPair.x_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL + CENTER_GRID_CELL_OFFSET;
+    float const centerY = (int32(cellPair.y_coord) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL + CENTER_GRID_CELL_OFFSET;
+    float minDistSq = -1.0f;
+    for (size_t i = 0; i < m_realPlayerX.size(); ++i)
+    {
+        float const dx = m_realPlayerX[i] - centerX;
+        float const dy = m_realPlayerY[i] - centerY;
+        float const distSq = dx * dx + dy * dy;
+        if (minDistSq < 0.0f || distSq < minDistSq)
+            minDistSq = distSq;
+    }
+
+    uint32 tier = m_maxTier;
+    if (minDistSq >= 0.0f)
+    {
+        float const dist = std::max(0.0f, sqrt(minDistSq) - SIZE_OF_GRID_CELL * 0.7071f);
+        tier = std::min(m_maxTier, uint32(dist / m_tierDistance));
+    }
+
+    m_cellTiers.emplace(cellId, tier);
+    return tier;
+}
+
+uint32 UpdateLodScheduler::GetTier(WorldObject& obj)
+{
+    if (obj.isActiveObject())
+        return 0;
+
+    if (obj.IsUnit() && static_cast<Unit&>(obj).IsInCombat())
+        return 0;
+
+    if (obj.IsPlayer())
+    {
+        Player& player = static_cast<Player&>(obj);
+        if (IsRealPlayer(&player))
+            return 0;
+
+        if (Group* group = player.GetGroup())
+            for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+                if (Player* member = itr->getSource())
+                    if (member != &player && IsRealPlayer(member))
+                        return 0;
+    }
+
+    return GetCellTier(obj.GetPositionX(), obj.GetPositionY());
+}
+
+bool UpdateLodScheduler::IsDue(WorldObject& obj, uint32 tickDiff, uint32& diff)
+{
+    diff = tickDiff;
+    if (!m_enabled)
+        return true;
+
+    return IsDueInTier(obj, GetTier(obj), tickDiff, diff);
+}
+
+bool UpdateLodScheduler::IsDueInTier(WorldObject& obj, uint32 tier, uint32 tickDiff, uint32& diff)
+{
+    uint32 const periodMask = (1 << tier) - 1;
+    if (((m_tick + obj.GetGUIDLow()) & periodMask) != 0)
+    {
+        obj.m_lodSkippedDiff += tickDiff;
+        ++m_skipped;
+        return false;
+    }
+
+    diff = tickDiff + obj.m_lodSkippedDiff;
+    obj.m_lodSkippedDiff = 0;
+    return true;
+}
+
+uint32 UpdateLodScheduler::UpdateObjects(std::unordered_set<WorldObject*> const& objects, uint32 tickDiff)
+{
+    if (!m_enabled)
+    {
+        for (WorldObject* obj : objects)
+            obj->Update(tickDiff);
+        return uint32(objects.size());
+    }
+
+    for (WorldObject* obj : objects)
+    {
+        uint32 const tier = GetTier(*obj);
+        uint32 diff;
+        if (IsDueInTier(*obj, tier, tickDiff, diff))
+            m_tiers[tier].push_back({ obj, diff });
+    }
+
+    uint32 count = 0;
+    for (std::vector<DueObject>& tier : m_tiers)
+    {
+        for (DueObject const& due : tier)
+            due.object->Update(due.diff);
+        count += uint32(tier.size());
+        tier.clear();
+    }
+    return count;
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_UPDATELODSCHEDULER_H
+#define MANGOS_UPDATELODSCHEDULER_H
+
+#include "Common.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Map;
+class Player;
+class WorldObject;
+
+#define UPDATE_LOD_MAX_TIERS 8
+
+/*
+  @class UpdateLodScheduler
+  Map local level of detail scheduling of object updates, see UpdateLod.* config options. Each object gets a
+  tier from the distance of its grid cell to the nearest real player (bots do not count), objects of tier n are
+  updated every 2^n map updates with the time elapsed since their previous update. Objects in combat, active
+  objects, real players and bots grouped with a real player always have tier 0. The update tick of an object
+  within its period is fixed by its guid, so updates of a tier are spread evenly over the ticks.
+ */
+class UpdateLodScheduler
+{
+    public:
+        UpdateLodScheduler() : m_enabled(false), m_tick(0), m_skipped(0), m_tierDistance(0.0f), m_maxTier(0) {}
+
+        // start of a map update, collects the real players of the map
+        void Prepare(Map& map);
+
+        // true if obj is updated in this map update, diff is then the time since its previous update
+        bool IsDue(WorldObject& obj, uint32 tickDiff, uint32& diff);
+
+        // updates the objects due in this map update tier by tier, returns the number of updated objects
+        uint32 UpdateObjects(std::unordered_set<WorldObject*> const& objects, uint32 tickDiff);
+
+        uint32 GetTier(WorldObject& obj);
+
+        // objects whose update was deferred since the previous call
+        uint32 GetAndResetSkipped() { uint32 skipped = m_skipped; m_skipped = 0; return skipped; }
+
+        static bool IsRealPlayer(Player* player);
+
+    private:
+        uint32 GetCellTier(float x, float y);
+        bool IsDueInTier(WorldObject& obj, uint32 tier, uint32 tickDiff, uint32& diff);
+
+        bool m_enabled;
+        uint32 m_tick;
+        uint32 m_skipped;
+        float m_tierDistance;
+        uint32 m_maxTier;
+
+        std::vector<float> m_realPlayerX;
+        std::vector<float> m_realPlayerY;
+        std::unordered_map<uint32, uint32> m_cellTiers;     // cell id -> tier, for the current map update
+
+        struct DueObject
+        {
+            WorldObject* object;
+            uint32 diff;
+        };
+        std::vector<DueObject> m_tiers[UPDATE_LOD_MAX_TIERS];
+};
+
+#endif
@@ -386,7 +386,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     WorldPacket data(opcode, recv_data.size());
     data << mover->GetPackGUID();             // write guid
     movementInfo.Write(data);                               // write data
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 }
 
 void WorldSession::HandleForceSpeedChangeAckOpcodes(WorldPacket& recv_data)
@@ -443,7 +443,7 @@ void WorldSession::HandleForceSpeedChangeAckOpcodes(WorldPacket& recv_data)
     data << guid.WriteAsPacked();
     data << movementInfo;
     data << newspeed;
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 
     // skip all forced speed changes except last and unexpected
     // in run/mounted case used one ACK and it must be skipped.m_forced_speed_changes[MOVE_RUN} store both.
@@ -558,7 +558,7 @@ void WorldSession::HandleMoveKnockBackAck(WorldPacket& recv_data)
     data << movementInfo.jump.sinAngle;
     data << movementInfo.jump.xyspeed;
     data << movementInfo.jump.zspeed;
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 }
 
 void WorldSession::SendKnockBack(Unit* who, float angle, float horizontalSpeed, float verticalSpeed)
@@ -589,7 +589,7 @@ void WorldSession::SendTeleportToObservers(float x, float y, float z, float orie
     MovementInfo moveInfo = _player->m_movementInfo;
     moveInfo.ChangePosition(x, y, z, orientation);
     data << moveInfo;
-    _player->SendMessageToSetExcept(data, _player);
+    _player->GetMap()->GetMovementRelay().Relay(_player, _player, data);
 }
 #endif
 
@@ -627,7 +627,7 @@ void WorldSession::HandleMoveFlagChangeOpcode(WorldPacket& recv_data)
     WorldPacket data(response, 8);
     data << guid.WriteAsPacked();
     data << movementInfo;
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 }
 
 void WorldSession::HandleMoveRootAck(WorldPacket& recv_data)
@@ -665,7 +665,7 @@ void WorldSession::HandleMoveRootAck(WorldPacket& recv_data)
     WorldPacket data(recv_data.GetOpcode() == CMSG_FORCE_MOVE_UNROOT_ACK ? MSG_MOVE_UNROOT : MSG_MOVE_ROOT);
     data << guid.WriteAsPacked();
     data << movementInfo;
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 }
 
 void WorldSession::HandleSummonResponseOpcode(WorldPacket& recv_data)
@@ -795,7 +795,7 @@ void WorldSession::HandleMoveTimeSkippedOpcode(WorldPacket& recv_data)
     WorldPacket data(MSG_MOVE_TIME_SKIPPED, 16);
     data << mover->GetPackGUID();
     data << timeSkipped;
-    mover->SendMessageToSetExcept(data, _player);
+    mover->GetMap()->GetMovementRelay().Relay(mover, _player, data);
 }
 
 bool WorldSession::ProcessMovementInfo(MovementInfo& movementInfo, Unit* mover, Player* plMover, WorldPacket& recv_data)
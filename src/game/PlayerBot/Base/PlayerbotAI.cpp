@@ -827,6 +827,22 @@ void PlayerbotAI::SendOrders(Player& /*player*/)
 }
 
 // handle outgoing packets the server would send to the client
+std::vector<uint16> const& PlayerbotAI::GetHandledOutgoingOpcodes()
+{
+    // keep in sync with HandleBotOutgoingPacket
+    static std::vector<uint16> const opcodes =
+    {
+        SMSG_DUEL_WINNER, SMSG_DUEL_COMPLETE, SMSG_DUEL_OUTOFBOUNDS, SMSG_DUEL_REQUESTED,
+        SMSG_AUCTION_COMMAND_RESULT, SMSG_INVENTORY_CHANGE_FAILURE, SMSG_ITEM_PUSH_RESULT,
+        SMSG_GROUP_INVITE, SMSG_GROUP_SET_LEADER, SMSG_PARTY_COMMAND_RESULT, SMSG_PARTYKILLLOG,
+        SMSG_LOOT_RESPONSE, SMSG_LOOT_RELEASE_RESPONSE, SMSG_LOOT_ROLL_WON,
+        SMSG_MESSAGECHAT, SMSG_RESURRECT_REQUEST, SMSG_TRADE_STATUS,
+        SMSG_SPELL_START, SMSG_SPELL_GO,
+        MSG_MOVE_TELEPORT_ACK, SMSG_TRANSFER_PENDING, SMSG_NEW_WORLD
+    };
+    return opcodes;
+}
+
 void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
 {
     switch (packet.GetOpcode())
@@ -3374,7 +3390,7 @@ void PlayerbotAI::UpdateAttackerInfo()
             continue;
         Unit* a = itr->second.attacker;
         float t = 0.00;
-        std::list<HostileReference*>::const_iterator i = a->getThreatManager().getThreatList().begin();
+        ThreatList::const_iterator i = a->getThreatManager().getThreatList().begin();
         for (; i != a->getThreatManager().getThreatList().end(); ++i)
         {
             if ((*i)->getThreat() > t && (*i)->getTarget() != m_bot)
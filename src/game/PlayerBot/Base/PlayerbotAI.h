@@ -346,6 +346,8 @@ class PlayerbotAI
         // Since there is no client at the other end, the packets are dropped of course.
         // For a list of opcodes that can be caught see Opcodes.cpp (SMSG_* opcodes only)
         void HandleBotOutgoingPacket(const WorldPacket& packet);
+        // Opcodes HandleBotOutgoingPacket acts on, the bot session drops all others unbuilt where possible
+        static std::vector<uint16> const& GetHandledOutgoingOpcodes();
 
         // Returns what kind of situation we are in so the ai can react accordingly
         ScenarioType GetScenarioType() { return m_ScenarioType; }
@@ -860,6 +860,7 @@ void PlayerbotMgr::OnBotLogin(Player* const bot)
     // give the bot some AI, object is owned by the player class
     PlayerbotAI* ai = new PlayerbotAI(*this, bot, m_confDebugWhisper);
     bot->SetPlayerbotAI(ai);
+    bot->GetSession()->SetBotOpcodes(PlayerbotAI::GetHandledOutgoingOpcodes());
 
     // tell the world session that they now manage this new bot
     m_playerBots[bot->GetObjectGuid()] = bot;
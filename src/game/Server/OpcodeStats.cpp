@@ -0,0 +1,199 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/OpcodeStats.h"
+#include "Server/Opcodes.h"
+#include "Log/Log.h"
+#include "Util/Util.h"
+#include "Policies/Singleton.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+INSTANTIATE_SINGLETON_1(OpcodeStats);
+
+namespace
+{
+    uint32 BucketOf(uint64 us)
+    {
+        uint32 bucket = 0;
+        while (bucket < OPCODE_STATS_BUCKETS - 1 && us >= (uint64(1) << bucket))
+            ++bucket;
+        return bucket;
+    }
+
+    template<class T>
+    T Load(std::atomic<T> const& counter)
+    {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    template<class T>
+    void Add(std::atomic<T>& counter, T value)
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+uint32 OpcodeStatsEntry::Percentile(uint32 const (&buckets)[OPCODE_STATS_BUCKETS], uint32 pct)
+{
+    uint64 total = 0;
+    for (uint32 count : buckets)
+        total += count;
+
+    if (!total)
+        return 0;
+
+    uint64 const rank = (total * pct + 99) / 100;
+    uint64 seen = 0;
+    for (uint32 i = 0; i < OPCODE_STATS_BUCKETS; ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+            return 1 << i;
+    }
+    return 1 << (OPCODE_STATS_BUCKETS - 1);
+}
+
+OpcodeStats::OpcodeStats() : m_counters(new Counters[NUM_MSG_TYPES]), m_rateBudgets(NUM_MSG_TYPES, 0)
+{
+    Reset();
+}
+
+void OpcodeStats::RecordReceived(uint16 opcode, size_t bytes)
+{
+    Counters& counters = m_counters[opcode];
+    Add<uint64>(counters.received, 1);
+    Add<uint64>(counters.bytesIn, bytes);
+}
+
+void OpcodeStats::RecordExecuted(uint16 opcode, uint64 waitUs, uint64 handlerUs)
+{
+    Counters& counters = m_counters[opcode];
+    Add<uint64>(counters.executed, 1);
+    Add<uint64>(counters.handlerTotal, handlerUs);
+    Add<uint64>(counters.waitTotal, waitUs);
+    Add<uint32>(counters.handlerBuckets[BucketOf(handlerUs)], 1);
+    Add<uint32>(counters.waitBuckets[BucketOf(waitUs)], 1);
+
+    uint32 const handlerMax = uint32(std::min<uint64>(handlerUs, 0xFFFFFFFF));
+    uint32 currentMax = Load(counters.handlerMax);
+    while (handlerMax > currentMax && !counters.handlerMax.compare_exchange_weak(currentMax, handlerMax, std::memory_order_relaxed)) {}
+}
+
+void OpcodeStats::RecordSent(uint16 opcode, size_t bytes)
+{
+    Counters& counters = m_counters[opcode];
+    Add<uint64>(counters.sent, 1);
+    Add<uint64>(counters.bytesOut, bytes);
+}
+
+void OpcodeStats::RecordOverBudget(uint16 opcode)
+{
+    Add<uint64>(m_counters[opcode].overBudget, 1);
+}
+
+void OpcodeStats::LoadRateBudgets(uint32 defaultBudget, std::string const& overrides)
+{
+    std::fill(m_rateBudgets.begin(), m_rateBudgets.end(), defaultBudget);
+
+    Tokens tokens = StrSplit(overrides, " ");
+    for (std::string const& token : tokens)
+    {
+        std::string::size_type const sep = token.find(':');
+        if (sep == std::string::npos)
+        {
+            sLog.outError("PacketRate.Budgets: invalid entry '%s', expected OPCODE_NAME:budget", token.c_str());
+            continue;
+        }
+
+        std::string const name = token.substr(0, sep);
+        uint32 const budget = uint32(atoi(token.c_str() + sep + 1));
+
+        uint32 opcode = 0;
+        for (; opcode < NUM_MSG_TYPES; ++opcode)
+            if (name == opcodeTable[opcode].name)
+                break;
+
+        if (opcode == NUM_MSG_TYPES)
+        {
+            sLog.outError("PacketRate.Budgets: unknown opcode '%s'", name.c_str());
+            continue;
+        }
+
+        m_rateBudgets[opcode] = budget;
+    }
+}
+
+std::vector<OpcodeStatsEntry> OpcodeStats::GetEntries() const
+{
+    std::vector<OpcodeStatsEntry> entries;
+    for (uint32 opcode = 0; opcode < NUM_MSG_TYPES; ++opcode)
+    {
+        Counters const& counters = m_counters[opcode];
+        if (!Load(counters.received) && !Load(counters.executed) && !Load(counters.sent))
+            continue;
+
+        OpcodeStatsEntry entry;
+        entry.opcode = uint16(opcode);
+        entry.received = Load(counters.received);
+        entry.bytesIn = Load(counters.bytesIn);
+        entry.executed = Load(counters.executed);
+        entry.handlerTotal = Load(counters.handlerTotal);
+        entry.handlerMax = Load(counters.handlerMax);
+        entry.waitTotal = Load(counters.waitTotal);
+        entry.sent = Load(counters.sent);
+        entry.bytesOut = Load(counters.bytesOut);
+        entry.overBudget = Load(counters.overBudget);
+        for (uint32 i = 0; i < OPCODE_STATS_BUCKETS; ++i)
+        {
+            entry.handlerBuckets[i] = Load(counters.handlerBuckets[i]);
+            entry.waitBuckets[i] = Load(counters.waitBuckets[i]);
+        }
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](OpcodeStatsEntry const& left, OpcodeStatsEntry const& right)
+    {
+        return left.handlerTotal > right.handlerTotal;
+    });
+    return entries;
+}
+
+void OpcodeStats::Reset()
+{
+    for (uint32 opcode = 0; opcode < NUM_MSG_TYPES; ++opcode)
+    {
+        Counters& counters = m_counters[opcode];
+        counters.received = 0;
+        counters.bytesIn = 0;
+        counters.executed = 0;
+        counters.handlerTotal = 0;
+        counters.handlerMax = 0;
+        counters.waitTotal = 0;
+        counters.sent = 0;
+        counters.bytesOut = 0;
+        counters.overBudget = 0;
+        for (uint32 i = 0; i < OPCODE_STATS_BUCKETS; ++i)
+        {
+            counters.handlerBuckets[i] = 0;
+            counters.waitBuckets[i] = 0;
+        }
+    }
+}
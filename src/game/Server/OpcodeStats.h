@@ -0,0 +1,99 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OPCODESTATS_H
+#define MANGOS_OPCODESTATS_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+// bucket n of a latency histogram counts durations below 2^n microseconds, last bucket everything above
+#define OPCODE_STATS_BUCKETS 20
+
+struct OpcodeStatsEntry
+{
+    uint16 opcode;
+    uint64 received;                                        // packets queued from client
+    uint64 bytesIn;
+    uint64 executed;                                        // handler calls
+    uint64 handlerTotal;                                    // microseconds
+    uint32 handlerMax;                                      // microseconds
+    uint64 waitTotal;                                       // microseconds between receive and handler call
+    uint64 sent;                                            // packets sent to clients
+    uint64 bytesOut;
+    uint64 overBudget;                                      // session rate budget overruns
+    uint32 handlerBuckets[OPCODE_STATS_BUCKETS];
+    uint32 waitBuckets[OPCODE_STATS_BUCKETS];
+
+    // upper bound (microseconds) of the bucket holding the pct percentile
+    static uint32 Percentile(uint32 const (&buckets)[OPCODE_STATS_BUCKETS], uint32 pct);
+};
+
+/*
+  @class OpcodeStats
+  Always enabled per opcode instrumentation of the packet path: handler execution time and queue wait
+  time histograms, bytes in and out, and packet rate budgets per session. Counters are relaxed atomics,
+  updated from network and map threads without locking.
+ */
+class OpcodeStats
+{
+    public:
+        OpcodeStats();
+
+        void RecordReceived(uint16 opcode, size_t bytes);
+        void RecordExecuted(uint16 opcode, uint64 waitUs, uint64 handlerUs);
+        void RecordSent(uint16 opcode, size_t bytes);
+        void RecordOverBudget(uint16 opcode);
+
+        // packets of opcode allowed per session and second, 0 for no limit
+        uint32 GetRateBudget(uint16 opcode) const { return m_rateBudgets[opcode]; }
+        // default budget and "OPCODE_NAME:budget" overrides separated by spaces
+        void LoadRateBudgets(uint32 defaultBudget, std::string const& overrides);
+
+        // opcodes with any activity, sorted by total handler time, highest first
+        std::vector<OpcodeStatsEntry> GetEntries() const;
+        void Reset();
+
+    private:
+        struct Counters
+        {
+            std::atomic<uint64> received;
+            std::atomic<uint64> bytesIn;
+            std::atomic<uint64> executed;
+            std::atomic<uint64> handlerTotal;
+            std::atomic<uint32> handlerMax;
+            std::atomic<uint64> waitTotal;
+            std::atomic<uint64> sent;
+            std::atomic<uint64> bytesOut;
+            std::atomic<uint64> overBudget;
+            std::atomic<uint32> handlerBuckets[OPCODE_STATS_BUCKETS];
+            std::atomic<uint32> waitBuckets[OPCODE_STATS_BUCKETS];
+        };
+
+        std::unique_ptr<Counters[]> m_counters;
+        std::vector<uint32> m_rateBudgets;
+};
+
+#define sOpcodeStats MaNGOS::Singleton<OpcodeStats>::Instance()
+
+#endif
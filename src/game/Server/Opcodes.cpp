@@ -80,7 +80,7 @@ OpcodeHandler opcodeTable[NUM_MSG_TYPES] =
     /*0x034*/ { "CMSG_AUTH_SRP6_PROOF",             STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_NULL},
     /*0x035*/ { "CMSG_AUTH_SRP6_RECODE",            STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_NULL},
     /*0x036*/ { "CMSG_CHAR_CREATE",                 STATUS_AUTHED,    PROCESS_THREADUNSAFE, &WorldSession::HandleCharCreateOpcode},
-    /*0x037*/ { "CMSG_CHAR_ENUM",                   STATUS_AUTHED,    PROCESS_THREADUNSAFE, &WorldSession::HandleCharEnumOpcode},
+    /*0x037*/ { "CMSG_CHAR_ENUM",                   STATUS_AUTHED,    PROCESS_THREADSAFE,   &WorldSession::HandleCharEnumOpcode},
     /*0x038*/ { "CMSG_CHAR_DELETE",                 STATUS_AUTHED,    PROCESS_THREADUNSAFE, &WorldSession::HandleCharDeleteOpcode},
     /*0x039*/ { "SMSG_AUTH_SRP6_RESPONSE",          STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
     /*0x03A*/ { "SMSG_CHAR_CREATE",                 STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
@@ -105,11 +105,11 @@ OpcodeHandler opcodeTable[NUM_MSG_TYPES] =
     /*0x04D*/ { "SMSG_LOGOUT_COMPLETE",             STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
     /*0x04E*/ { "CMSG_LOGOUT_CANCEL",               STATUS_LOGGEDIN,  PROCESS_THREADUNSAFE, &WorldSession::HandleLogoutCancelOpcode},
     /*0x04F*/ { "SMSG_LOGOUT_CANCEL_ACK",           STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
-    /*0x050*/ { "CMSG_NAME_QUERY",                  STATUS_AUTHED,    PROCESS_THREADUNSAFE, &WorldSession::HandleNameQueryOpcode},
+    /*0x050*/ { "CMSG_NAME_QUERY",                  STATUS_AUTHED,    PROCESS_THREADSAFE,   &WorldSession::HandleNameQueryOpcode},
     /*0x051*/ { "SMSG_NAME_QUERY_RESPONSE",         STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
     /*0x052*/ { "CMSG_PET_NAME_QUERY",              STATUS_LOGGEDIN,  PROCESS_THREADUNSAFE, &WorldSession::HandlePetNameQueryOpcode},
     /*0x053*/ { "SMSG_PET_NAME_QUERY_RESPONSE",     STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
-    /*0x054*/ { "CMSG_GUILD_QUERY",                 STATUS_AUTHED,    PROCESS_THREADUNSAFE, &WorldSession::HandleGuildQueryOpcode},
+    /*0x054*/ { "CMSG_GUILD_QUERY",                 STATUS_AUTHED,    PROCESS_THREADSAFE,   &WorldSession::HandleGuildQueryOpcode},
     /*0x055*/ { "SMSG_GUILD_QUERY_RESPONSE",        STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_ServerSide},
     /*0x056*/ { "CMSG_ITEM_QUERY_SINGLE",           STATUS_LOGGEDIN,  PROCESS_IMMEDIATE,    &WorldSession::HandleItemQuerySingleOpcode},
     /*0x057*/ { "CMSG_ITEM_QUERY_MULTIPLE",         STATUS_NEVER,     PROCESS_INPLACE,      &WorldSession::Handle_NULL},
@@ -51,6 +51,6 @@ class WorldPacket : public ByteBuffer
 
     private:
         Opcodes m_opcode;
-        std::chrono::steady_clock::time_point m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
+        std::chrono::steady_clock::time_point m_receivedTime; // set when queued for a handler, not for immediately processed opcodes
 };
 #endif
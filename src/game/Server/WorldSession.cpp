@@ -40,6 +40,7 @@
 #include "GMTickets/GMTicketMgr.h"
 #include "Loot/LootMgr.h"
 #include "Anticheat/Anticheat.hpp"
+#include "Server/OpcodeStats.h"
 
 #include <mutex>
 #include <deque>
@@ -72,6 +73,13 @@ static bool MapSessionFilterHelper(WorldSession* session, OpcodeHandler const& o
     return plr->IsInWorld();
 }
 
+// select opcodes appropriate for processing in World::UpdateSessionsParallel() by the session workers
+static bool SessionWorkerFilterHelper(OpcodeHandler const& opHandle)
+{
+    // only handlers that need no player in a map, the maps are not updated while the workers run
+    return opHandle.packetProcessing == PROCESS_THREADSAFE && opHandle.status == STATUS_AUTHED;
+}
+
 
 bool MapSessionFilter::Process(WorldPacket const& packet) const
 {
@@ -104,7 +112,8 @@ WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, time_
     m_clientOS(CLIENT_OS_UNKNOWN), m_clientPlatform(CLIENT_PLATFORM_UNKNOWN), m_orderCounter(0),
     _logoutTime(0), m_afkTime(0), m_playerSave(true), m_inQueue(false), m_playerLoading(false), m_kickSession(false), m_playerLogout(false), m_playerRecentlyLogout(false),
     m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)), m_sessionDbLocaleIndex(sObjectMgr.GetStorageLocaleIndexFor(locale)),
-    m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED)
+    m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED), m_hasParallelPackets(false), m_inSessionWorker(false),
+    m_packetRateWindow(0)
     {}
 
 /// WorldSession destructor
@@ -123,6 +132,9 @@ WorldSession::~WorldSession()
 
         m_socket->FinalizeSession();
     }
+
+    for (QueryResult* result : m_pendingCharEnums)
+        delete result;
 }
 
 void WorldSession::SetOffline()
@@ -196,6 +208,9 @@ void WorldSession::SetPlayer(Player* plr, uint32 playerGuid)
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const& packet, bool forcedSend /*= false*/) const
 {
+    if (!WantsOpcode(packet.GetOpcode()))
+        return;
+
 #if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
     // Send packet to bot AI
     if (GetPlayer())
@@ -249,16 +264,49 @@ void WorldSession::SendPacket(WorldPacket const& packet, bool forcedSend /*= fal
 
 #endif                                                  // !MANGOS_DEBUG
 
+    sOpcodeStats.RecordSent(packet.GetOpcode(), packet.size());
     m_socket->SendPacket(packet);
 }
 
+void WorldSession::SendSharedPacket(WorldPacket const& packet, SharedPacketBody const& body) const
+{
+#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
+    // bot sessions inspect outgoing packets, keep the regular path for them
+    if (GetPlayer() && (GetPlayer()->GetPlayerbotAI() || GetPlayer()->GetPlayerbotMgr()))
+    {
+        SendPacket(packet);
+        return;
+    }
+#endif
+
+    if (!m_socket || m_sessionState != WORLD_SESSION_STATE_READY)
+        return;
+
+    sOpcodeStats.RecordSent(packet.GetOpcode(), packet.size());
+    m_socket->SendSharedPacket(packet, body);
+}
+
+void WorldSession::SetBotOpcodes(std::vector<uint16> const& opcodes)
+{
+    if (m_socket)
+        return;
+
+    m_botOpcodes.assign(NUM_MSG_TYPES, false);
+    for (uint16 opcode : opcodes)
+        m_botOpcodes[opcode] = true;
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(std::unique_ptr<WorldPacket> new_packet)
 {
     sWorld.IncrementOpcodeCounter(new_packet->GetOpcode());
+    sOpcodeStats.RecordReceived(new_packet->GetOpcode(), new_packet->size());
+    CheckPacketRate(new_packet->GetOpcode());
+
     OpcodeHandler const& opHandle = opcodeTable[new_packet->GetOpcode()];
     if (opHandle.packetProcessing == PROCESS_IMMEDIATE)
     {
+        auto const startTime = std::chrono::steady_clock::now();
         try
         {
             (this->*opHandle.handler)(*new_packet);
@@ -267,12 +315,16 @@ void WorldSession::QueuePacket(std::unique_ptr<WorldPacket> new_packet)
         {
             ProcessByteBufferException(*new_packet);
         }
+        sOpcodeStats.RecordExecuted(new_packet->GetOpcode(), 0,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
 
         if (new_packet->rpos() < new_packet->wpos() && sLog.HasLogLevelOrHigher(LOG_LVL_DEBUG))
             LogUnprocessedTail(*new_packet);
         return;
     }
 
+    new_packet->SetReceivedTime(std::chrono::steady_clock::now());
+
     if (opHandle.packetProcessing == PROCESS_MAP_THREAD)
     {
         std::lock_guard<std::mutex> guard(m_recvQueueMapLock);
@@ -280,11 +332,37 @@ void WorldSession::QueuePacket(std::unique_ptr<WorldPacket> new_packet)
     }
     else
     {
+        bool const parallel = SessionWorkerFilterHelper(opHandle);
         std::lock_guard<std::mutex> guard(m_recvQueueLock);
         m_recvQueue.push_back(std::move(new_packet));
+        if (parallel)
+            m_hasParallelPackets = true;
     }
 }
 
+/// Flag the session when it sends an opcode more often than its budget allows
+void WorldSession::CheckPacketRate(uint16 opcode)
+{
+    uint32 const budget = sOpcodeStats.GetRateBudget(opcode);
+    if (!budget)
+        return;
+
+    time_t const now = time(nullptr);
+    if (now != m_packetRateWindow)
+    {
+        m_packetRateWindow = now;
+        m_packetRateCounts.clear();
+    }
+
+    // reported once per second and opcode
+    if (++m_packetRateCounts[opcode] != budget + 1)
+        return;
+
+    sOpcodeStats.RecordOverBudget(opcode);
+    sLog.outError("WorldSession: account %u (%s) sent more than %u %s packets in one second",
+        GetAccountId(), GetRemoteAddress().c_str(), budget, LookupOpcodeName(opcode));
+}
+
 void WorldSession::DeleteMovementPackets()
 {
     std::lock_guard<std::mutex> guard(m_recvQueueMapLock);
@@ -373,73 +451,7 @@ bool WorldSession::Update(uint32 diff)
         auto const packet = std::move(recvQueueCopy.front());
         recvQueueCopy.pop_front();
 
-        OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
-        switch (opHandle.status)
-        {
-            case STATUS_LOGGEDIN:
-                if (!_player)
-                {
-                    // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
-                    if (!m_playerRecentlyLogout)
-                        LogUnexpectedOpcode(*packet, "the player has not logged in yet");
-                }
-                else if (_player->IsInWorld())
-                    ExecuteOpcode(opHandle, *packet);
-
-                // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
-
-#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
-                if (_player && _player->GetPlayerbotMgr())
-                    _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(*packet);
-#endif
-                break;
-            case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
-                if (!_player && !m_playerRecentlyLogout)
-                {
-                    LogUnexpectedOpcode(*packet, "the player has not logged in yet and not recently logout");
-                }
-                else
-                    // not expected _player or must checked in packet hanlder
-                    ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_TRANSFER:
-                if (!_player)
-                    LogUnexpectedOpcode(*packet, "the player has not logged in yet");
-                else if (_player->IsInWorld())
-                    LogUnexpectedOpcode(*packet, "the player is still in world");
-                else
-                    ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_AUTHED:
-                // prevent cheating with skip queue wait
-                if (m_inQueue && packet->GetOpcode() != CMSG_WARDEN_DATA)
-                {
-                    LogUnexpectedOpcode(*packet, "the player not pass queue yet");
-                    break;
-                }
-
-                // single from authed time opcodes send in to after logout time
-                // and before other STATUS_LOGGEDIN_OR_RECENTLY_LOGGOUT opcodes.
-                m_playerRecentlyLogout = false;
-
-                ExecuteOpcode(opHandle, *packet);
-                break;
-            case STATUS_NEVER:
-                sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
-                              packet->GetOpcodeName(),
-                              packet->GetOpcode());
-                break;
-            case STATUS_UNHANDLED:
-                DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
-                          packet->GetOpcodeName(),
-                          packet->GetOpcode());
-                break;
-            default:
-                sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
-                              packet->GetOpcodeName(),
-                              packet->GetOpcode());
-                break;
-        }
+        ProcessPacket(*packet);
     }
 
 #ifdef BUILD_DEPRECATED_PLAYERBOT
@@ -559,6 +571,112 @@ bool WorldSession::Update(uint32 diff)
     return true;
 }
 
+void WorldSession::ProcessPacket(WorldPacket& packet)
+{
+    OpcodeHandler const& opHandle = opcodeTable[packet.GetOpcode()];
+    switch (opHandle.status)
+    {
+        case STATUS_LOGGEDIN:
+            if (!_player)
+            {
+                // skip STATUS_LOGGEDIN opcode unexpected errors if player logout sometime ago - this can be network lag delayed packets
+                if (!m_playerRecentlyLogout)
+                    LogUnexpectedOpcode(packet, "the player has not logged in yet");
+            }
+            else if (_player->IsInWorld())
+                ExecuteOpcode(opHandle, packet);
+
+            // lag can cause STATUS_LOGGEDIN opcodes to arrive after the player started a transfer
+
+#if defined(BUILD_DEPRECATED_PLAYERBOT) || defined(ENABLE_PLAYERBOTS)
+            if (_player && _player->GetPlayerbotMgr())
+                _player->GetPlayerbotMgr()->HandleMasterIncomingPacket(packet);
+#endif
+            break;
+        case STATUS_LOGGEDIN_OR_RECENTLY_LOGGEDOUT:
+            if (!_player && !m_playerRecentlyLogout)
+            {
+                LogUnexpectedOpcode(packet, "the player has not logged in yet and not recently logout");
+            }
+            else
+                // not expected _player or must checked in packet hanlder
+                ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_TRANSFER:
+            if (!_player)
+                LogUnexpectedOpcode(packet, "the player has not logged in yet");
+            else if (_player->IsInWorld())
+                LogUnexpectedOpcode(packet, "the player is still in world");
+            else
+                ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_AUTHED:
+            // prevent cheating with skip queue wait
+            if (m_inQueue && packet.GetOpcode() != CMSG_WARDEN_DATA)
+            {
+                LogUnexpectedOpcode(packet, "the player not pass queue yet");
+                break;
+            }
+
+            // single from authed time opcodes send in to after logout time
+            // and before other STATUS_LOGGEDIN_OR_RECENTLY_LOGGOUT opcodes.
+            m_playerRecentlyLogout = false;
+
+            ExecuteOpcode(opHandle, packet);
+            break;
+        case STATUS_NEVER:
+            sLog.outError("SESSION: received not allowed opcode %s (0x%.4X)",
+                          packet.GetOpcodeName(),
+                          packet.GetOpcode());
+            break;
+        case STATUS_UNHANDLED:
+            DEBUG_LOG("SESSION: received not handled opcode %s (0x%.4X)",
+                      packet.GetOpcodeName(),
+                      packet.GetOpcode());
+            break;
+        default:
+            sLog.outError("SESSION: received wrong-status-req opcode %s (0x%.4X)",
+                          packet.GetOpcodeName(),
+                          packet.GetOpcode());
+            break;
+    }
+}
+
+void WorldSession::UpdateParallel()
+{
+    m_inSessionWorker = true;
+
+    // character lists queried by the world thread, building them reads all items of all characters of the account
+    for (QueryResult* result : m_pendingCharEnums)
+    {
+        if (m_socket && !m_socket->IsClosed())
+            BuildCharEnum(result);
+        else
+            delete result;
+    }
+    m_pendingCharEnums.clear();
+
+    // packets queued from now on flag the session again
+    m_hasParallelPackets = false;
+    while (m_socket && !m_socket->IsClosed())
+    {
+        std::unique_ptr<WorldPacket> packet;
+        {
+            std::lock_guard<std::mutex> guard(m_recvQueueLock);
+            // stop at the first packet needing the world thread, Update() continues from there in order
+            if (m_recvQueue.empty() || !SessionWorkerFilterHelper(opcodeTable[m_recvQueue.front()->GetOpcode()]))
+                break;
+
+            packet = std::move(m_recvQueue.front());
+            m_recvQueue.pop_front();
+        }
+
+        ProcessPacket(*packet);
+    }
+
+    m_inSessionWorker = false;
+}
+
 void WorldSession::UpdateMap(uint32 diff)
 {
     std::deque<std::unique_ptr<WorldPacket>> recvQueueMapCopy;
@@ -1193,9 +1311,11 @@ void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& pac
 {
     // need prevent do internal far teleports in handlers because some handlers do lot steps
     // or call code that can do far teleports in some conditions unexpectedly for generic way work code
-    if (_player)
+    // session workers handle only packets that do not touch the player, teleports are left to the world thread
+    if (_player && !m_inSessionWorker)
         _player->SetCanDelayTeleport(true);
 
+    auto const startTime = std::chrono::steady_clock::now();
     try
     {
         (this->*opHandle.handler)(packet);
@@ -1204,8 +1324,15 @@ void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& pac
     {
         ProcessByteBufferException(packet);
     }
+    auto const endTime = std::chrono::steady_clock::now();
 
-    if (_player)
+    // packets built by the server itself (bots) have no receive time
+    uint64 waitUs = 0;
+    if (packet.GetReceivedTime().time_since_epoch().count() && packet.GetReceivedTime() < startTime)
+        waitUs = std::chrono::duration_cast<std::chrono::microseconds>(startTime - packet.GetReceivedTime()).count();
+    sOpcodeStats.RecordExecuted(packet.GetOpcode(), waitUs, std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count());
+
+    if (_player && !m_inSessionWorker)
     {
         // can be not set in fact for login opcode, but this not create porblems.
         _player->SetCanDelayTeleport(false);
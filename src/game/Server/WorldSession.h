@@ -37,6 +37,7 @@
 #include <deque>
 #include <mutex>
 #include <memory>
+#include <vector>
 
 struct ItemPrototype;
 struct AuctionEntry;
@@ -222,6 +223,12 @@ class WorldSession
         void SizeError(WorldPacket const& packet, uint32 size) const;
 
         void SendPacket(WorldPacket const& packet, bool forcedSend = false) const;
+        // broadcast send, body is built once by the broadcaster and shared between all receivers
+        void SendSharedPacket(WorldPacket const& packet, SharedPacketBody const& body) const;
+        // sessions without client (bots) only get the opcodes their AI parses, others are dropped before sending
+        // and object updates are not built for them at all
+        void SetBotOpcodes(std::vector<uint16> const& opcodes);
+        bool WantsOpcode(uint16 opcode) const { return m_botOpcodes.empty() || m_botOpcodes[opcode]; }
         void SendExpectedSpamRecords();
         void SendMotd(Player* currChar);
         void SendOfflineNameQueryResponses();
@@ -303,6 +310,10 @@ class WorldSession
         void DeleteMovementPackets();
 
         bool Update(uint32 diff);
+        // handles the queued thread safe packets and character lists, run by the session workers before Update()
+        void UpdateParallel();
+        // true if UpdateParallel() has something to do, checked by the world thread before starting the workers
+        bool HasParallelWork() const { return m_hasParallelPackets || !m_pendingCharEnums.empty(); }
         void UpdateMap(uint32 diff);
 
         /// Handle the authentication waiting queue (to be completed)
@@ -811,7 +822,10 @@ class WorldSession
         bool VerifyMovementInfo(MovementInfo const& movementInfo, Unit* mover, bool unroot) const;
         void HandleMoverRelocation(MovementInfo& movementInfo);
 
+        void ProcessPacket(WorldPacket& packet);
+        void BuildCharEnum(QueryResult* result);
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& packet);
+        void CheckPacketRate(uint16 opcode);
 
         // logging helper
         void LogUnexpectedOpcode(WorldPacket const& packet, const char* reason) const;
@@ -869,6 +883,18 @@ class WorldSession
         std::mutex m_recvQueueMapLock;
         std::deque<std::unique_ptr<WorldPacket>> m_recvQueue;
         std::deque<std::unique_ptr<WorldPacket>> m_recvQueueMap;
+        std::atomic<bool> m_hasParallelPackets;             // a thread safe packet was queued since the last UpdateParallel()
+        bool m_inSessionWorker;                             // UpdateParallel() is running, player and world state must not be touched
+        // character list query results waiting for the session workers, only touched by the world thread
+        // outside of UpdateParallel() and by the worker inside it
+        std::vector<QueryResult*> m_pendingCharEnums;
+
+        // received packets per opcode in current second, see PacketRate.* config options
+        time_t m_packetRateWindow;
+        std::unordered_map<uint16, uint32> m_packetRateCounts;
+
+        // opcode subscription of bot sessions indexed by opcode, empty for client sessions
+        std::vector<bool> m_botOpcodes;
 
         Messager<WorldSession> m_messager;
 
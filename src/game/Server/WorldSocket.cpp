@@ -97,20 +97,21 @@ WorldSocket::WorldSocket(boost::asio::io_service& service) : AsyncSocket(service
 {
 }
 
-void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
+bool WorldSocket::LogOutgoingPacket(const WorldPacket& pct)
 {
     if (IsClosed())
-        return;
+        return false;
 
     if (sPacketLog->CanLogPacket() && IsLoggingPackets())
         sPacketLog->LogPacket(pct, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
     // Dump outgoing packet.
     sLog.outWorldPacketDump(GetRemoteEndpoint().c_str(), pct.GetOpcode(), pct.GetOpcodeName(), pct, false);
+    return true;
+}
 
-    // encrypt thread unsafe due to being executed from map contexts frequently - TODO: move to post service context in future
-    std::lock_guard<std::mutex> guard(m_worldSocketMutex);
-
+ServerPktHeader WorldSocket::BuildServerHeader(const WorldPacket& pct)
+{
     ServerPktHeader header;
 
     header.cmd = pct.GetOpcode();
@@ -127,6 +128,19 @@ void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
     if (m_opcodeHistoryOut.size() > 50)
         m_opcodeHistoryOut.resize(30);
 
+    return header;
+}
+
+void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
+{
+    if (!LogOutgoingPacket(pct))
+        return;
+
+    // encrypt thread unsafe due to being executed from map contexts frequently - TODO: move to post service context in future
+    std::lock_guard<std::mutex> guard(m_worldSocketMutex);
+
+    ServerPktHeader header = BuildServerHeader(pct);
+
     if (pct.size() > 0)
     {
         // allocate array for full message
@@ -144,6 +158,19 @@ void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
     }
 }
 
+void WorldSocket::SendSharedPacket(const WorldPacket& pct, SharedPacketBody const& body)
+{
+    if (!LogOutgoingPacket(pct))
+        return;
+
+    std::lock_guard<std::mutex> guard(m_worldSocketMutex);
+
+    // only the header is per socket (own encryption state), body is written from the shared buffer without copy
+    std::shared_ptr<ServerPktHeader> sharedHeader = std::make_shared<ServerPktHeader>(BuildServerHeader(pct));
+    auto self(shared_from_this());
+    Write(sharedHeader->data(), sharedHeader->headerSize(), body->data(), body->size(), [self, sharedHeader, body](const boost::system::error_code& error, std::size_t read) {});
+}
+
 bool WorldSocket::OnOpen()
 {
     // Send startup packet.
@@ -33,9 +33,15 @@
 #include <chrono>
 #include <functional>
 #include <deque>
+#include <memory>
+#include <vector>
 
 class WorldPacket;
 class WorldSession;
+struct ServerPktHeader;
+
+// packet contents built once for a broadcast and shared by the send queue of every receiver
+typedef std::shared_ptr<std::vector<char> const> SharedPacketBody;
 
 /**
  * WorldSocket.
@@ -118,6 +124,12 @@ class WorldSocket : public MaNGOS::AsyncSocket<WorldSocket>
         /// Called by ProcessIncoming() on CMSG_PING.
         bool HandlePing(WorldPacket& recvPacket);
 
+        /// Log outgoing packet, return false if socket is closed
+        bool LogOutgoingPacket(const WorldPacket& pct);
+
+        /// Build and encrypt header of an outgoing packet, must be called under m_worldSocketMutex
+        struct ServerPktHeader BuildServerHeader(const WorldPacket& pct);
+
         std::mutex m_worldSocketMutex;
 
         std::deque<uint32> m_opcodeHistoryOut;
@@ -130,6 +142,8 @@ class WorldSocket : public MaNGOS::AsyncSocket<WorldSocket>
 
         // send a packet \o/
         void SendPacket(const WorldPacket& pct, bool immediate = false);
+        // send a broadcast packet, only the header is built for this socket, body is shared with other receivers
+        void SendSharedPacket(const WorldPacket& pct, SharedPacketBody const& body);
 
         void FinalizeSession() { m_session = nullptr; }
 
@@ -1149,7 +1149,7 @@ namespace MaNGOS
 
 typedef void(Spell::*pEffect)(SpellEffectIndex eff_idx);
 
-class SpellEvent : public BasicEvent
+class SpellEvent : public PooledBasicEvent<SpellEvent>
 {
     public:
         SpellEvent(Spell* spell);
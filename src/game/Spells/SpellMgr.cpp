@@ -1058,6 +1058,8 @@ void SpellMgr::LoadSpellElixirs()
         return;
     }
 
+    std::map<uint32, uint8> spellElixirs;
+
     BarGoLink bar(queryResult->GetRowCount());
 
     do
@@ -1077,24 +1079,28 @@ void SpellMgr::LoadSpellElixirs()
             continue;
         }
 
-        mSpellElixirs[entry] = mask;
+        spellElixirs[entry] = mask;
 
         ++count;
     }
     while (queryResult->NextRow());
 
+    mSpellElixirs.Assign(spellElixirs);
+
     sLog.outString(">> Loaded %u spell elixir definitions", count);
     sLog.outString();
 }
 
+typedef std::map<uint32, SpellThreatEntry> SpellThreatLoadMap;
+
 struct DoSpellThreat
 {
-    DoSpellThreat(SpellThreatMap& _threatMap) : threatMap(_threatMap), count(0) {}
+    DoSpellThreat(SpellThreatLoadMap& _threatMap) : threatMap(_threatMap), count(0) {}
     void operator()(uint32 spell_id)
     {
         SpellThreatEntry const& ste = state->second;
         // add ranks only for not filled data (spells adding flat threat are usually different for ranks)
-        SpellThreatMap::const_iterator spellItr = threatMap.find(spell_id);
+        SpellThreatLoadMap::const_iterator spellItr = threatMap.find(spell_id);
         if (spellItr == threatMap.end())
             threatMap[spell_id] = ste;
 
@@ -1147,8 +1153,8 @@ struct DoSpellThreat
     bool HasEntry(uint32 spellId) const { return threatMap.count(spellId) > 0; }
     bool SetStateToEntry(uint32 spellId) { return (state = threatMap.find(spellId)) != threatMap.end(); }
 
-    SpellThreatMap& threatMap;
-    SpellThreatMap::const_iterator state;
+    SpellThreatLoadMap& threatMap;
+    SpellThreatLoadMap::const_iterator state;
     uint32 count;
 };
 
@@ -1167,7 +1173,8 @@ void SpellMgr::LoadSpellThreats()
         return;
     }
 
-    SpellRankHelper<SpellThreatEntry, DoSpellThreat, SpellThreatMap> rankHelper(*this, mSpellThreatMap);
+    SpellThreatLoadMap spellThreats;
+    SpellRankHelper<SpellThreatEntry, DoSpellThreat, SpellThreatLoadMap> rankHelper(*this, spellThreats);
 
     BarGoLink bar(queryResult->GetRowCount());
 
@@ -1190,6 +1197,8 @@ void SpellMgr::LoadSpellThreats()
 
     rankHelper.FillHigherRanks();
 
+    mSpellThreatMap.Assign(spellThreats);
+
     sLog.outString(">> Loaded %u spell threat entries", rankHelper.worker.count);
     sLog.outString();
 }
@@ -1731,6 +1740,8 @@ void SpellMgr::LoadSpellLearnSkills()
 {
     mSpellLearnSkills.clear();                              // need for reload case
 
+    std::map<uint32, SpellLearnSkillNode> spellLearnSkills;
+
     // search auto-learned skills and add its to map also for use in unlearn spells/talents
     uint32 dbc_count = 0;
     BarGoLink bar(sSpellTemplate.GetMaxEntry());
@@ -1753,7 +1764,7 @@ void SpellMgr::LoadSpellLearnSkills()
 
                 if (dbc_node.skill && dbc_node.step)
                 {
-                    mSpellLearnSkills[spell] = dbc_node;
+                    spellLearnSkills[spell] = dbc_node;
                     ++dbc_count;
                     break;
                 }
@@ -1761,6 +1772,8 @@ void SpellMgr::LoadSpellLearnSkills()
         }
     }
 
+    mSpellLearnSkills.Assign(spellLearnSkills);
+
     sLog.outString(">> Loaded %u Spell Learn Skills from DBC", dbc_count);
     sLog.outString();
 }
@@ -1782,6 +1795,7 @@ void SpellMgr::LoadSpellLearnSpells()
         return;
     }
 
+    std::multimap<uint32, SpellLearnSpellNode> spellLearnSpells;
     uint32 count = 0;
 
     BarGoLink bar(queryResult->GetRowCount());
@@ -1815,7 +1829,7 @@ void SpellMgr::LoadSpellLearnSpells()
             continue;
         }
 
-        mSpellLearnSpells.insert(SpellLearnSpellMap::value_type(spell_id, node));
+        spellLearnSpells.emplace(spell_id, node);
 
         ++count;
     }
@@ -1847,10 +1861,10 @@ void SpellMgr::LoadSpellLearnSpells()
                 // other required explicit dependent learning
                 dbc_node.autoLearned = entry->EffectImplicitTargetA[i] == TARGET_UNIT_CASTER_PET || GetTalentSpellCost(spell) > 0 || IsPassiveSpell(entry) || IsSpellHaveEffect(entry, SPELL_EFFECT_SKILL_STEP);
 
-                SpellLearnSpellMapBounds db_node_bounds = GetSpellLearnSpellMapBounds(spell);
+                auto db_node_bounds = spellLearnSpells.equal_range(spell);
 
                 bool found = false;
-                for (SpellLearnSpellMap::const_iterator itr = db_node_bounds.first; itr != db_node_bounds.second; ++itr)
+                for (auto itr = db_node_bounds.first; itr != db_node_bounds.second; ++itr)
                 {
                     if (itr->second.spell == dbc_node.spell)
                     {
@@ -1863,13 +1877,15 @@ void SpellMgr::LoadSpellLearnSpells()
 
                 if (!found)                                 // add new spell-spell pair if not found
                 {
-                    mSpellLearnSpells.insert(SpellLearnSpellMap::value_type(spell, dbc_node));
+                    spellLearnSpells.emplace(spell, dbc_node);
                     ++dbc_count;
                 }
             }
         }
     }
 
+    mSpellLearnSpells.Assign(spellLearnSpells);
+
     sLog.outString(">> Loaded %u spell learn spells + %u found in DBC", count, dbc_count);
     sLog.outString();
 }
@@ -2178,6 +2194,7 @@ void SpellMgr::LoadSpellAreas()
 {
     mSpellAreaMap.clear();                                  // need for reload case
     mSpellAreaForAuraMap.clear();
+    mSpellAreaForAreaMap.clear();
 
     uint32 count = 0;
 
@@ -2193,6 +2210,10 @@ void SpellMgr::LoadSpellAreas()
         return;
     }
 
+    // filled in node based containers while checking, then frozen into the lookup tables
+    std::multimap<uint32, SpellArea> spellAreas;
+    std::multimap<uint32, SpellArea const*> spellAreasForAura;
+
     BarGoLink bar(queryResult->GetRowCount());
 
     do
@@ -2222,8 +2243,8 @@ void SpellMgr::LoadSpellAreas()
 
         {
             bool ok = true;
-            SpellAreaMapBounds sa_bounds = GetSpellAreaMapBounds(spellArea.spellId);
-            for (SpellAreaMap::const_iterator itr = sa_bounds.first; itr != sa_bounds.second; ++itr)
+            auto sa_bounds = spellAreas.equal_range(spellArea.spellId);
+            for (auto itr = sa_bounds.first; itr != sa_bounds.second; ++itr)
             {
                 if (spellArea.spellId != itr->second.spellId)
                     continue;
@@ -2334,8 +2355,8 @@ void SpellMgr::LoadSpellAreas()
             if (spellArea.autocast && spellArea.auraSpell > 0)
             {
                 bool chain = false;
-                SpellAreaForAuraMapBounds saBound = GetSpellAreaForAuraMapBounds(spellArea.spellId);
-                for (SpellAreaForAuraMap::const_iterator itr = saBound.first; itr != saBound.second; ++itr)
+                auto saBound = spellAreasForAura.equal_range(spellArea.spellId);
+                for (auto itr = saBound.first; itr != saBound.second; ++itr)
                 {
                     if (itr->second->autocast && itr->second->auraSpell > 0)
                     {
@@ -2350,8 +2371,8 @@ void SpellMgr::LoadSpellAreas()
                     continue;
                 }
 
-                SpellAreaMapBounds saBound2 = GetSpellAreaMapBounds(spellArea.auraSpell);
-                for (SpellAreaMap::const_iterator itr2 = saBound2.first; itr2 != saBound2.second; ++itr2)
+                auto saBound2 = spellAreas.equal_range(spellArea.auraSpell);
+                for (auto itr2 = saBound2.first; itr2 != saBound2.second; ++itr2)
                 {
                     if (itr2->second.autocast && itr2->second.auraSpell > 0)
                     {
@@ -2368,20 +2389,34 @@ void SpellMgr::LoadSpellAreas()
             }
         }
 
-        SpellArea const* sa = &mSpellAreaMap.insert(SpellAreaMap::value_type(spell, spellArea))->second;
-
-        // for search by current zone/subzone at zone/subzone change
-        if (spellArea.areaId)
-            mSpellAreaForAreaMap.insert(SpellAreaForAreaMap::value_type(spellArea.areaId, sa));
+        SpellArea const* sa = &spellAreas.emplace(spell, spellArea)->second;
 
-        // for search at aura apply
         if (spellArea.auraSpell)
-            mSpellAreaForAuraMap.insert(SpellAreaForAuraMap::value_type(abs(spellArea.auraSpell), sa));
+            spellAreasForAura.emplace(abs(spellArea.auraSpell), sa);
 
         ++count;
     }
     while (queryResult->NextRow());
 
+    mSpellAreaMap.Assign(spellAreas);
+
+    // secondary indexes point into the frozen storage, so build them only after it is final
+    std::multimap<uint32, SpellArea const*> spellAreasForArea;
+    spellAreasForAura.clear();
+    for (auto const& itr : mSpellAreaMap)
+    {
+        // for search by current zone/subzone at zone/subzone change
+        if (itr.second.areaId)
+            spellAreasForArea.emplace(itr.second.areaId, &itr.second);
+
+        // for search at aura apply
+        if (itr.second.auraSpell)
+            spellAreasForAura.emplace(abs(itr.second.auraSpell), &itr.second);
+    }
+
+    mSpellAreaForAreaMap.Assign(spellAreasForArea);
+    mSpellAreaForAuraMap.Assign(spellAreasForAura);
+
     sLog.outString(">> Loaded %u spell area requirements", count);
     sLog.outString();
 }
@@ -2445,18 +2480,24 @@ void SpellMgr::LoadSkillLineAbilityMaps()
     const uint32 rows = sSkillLineAbilityStore.GetNumRows();
     uint32 count = 0;
 
+    std::multimap<uint32, SkillLineAbilityEntry const*> bySpellId;
+    std::multimap<uint32, SkillLineAbilityEntry const*> bySkillId;
+
     BarGoLink bar(rows);
     for (uint32 row = 0; row < rows; ++row)
     {
         bar.step();
         if (SkillLineAbilityEntry const* entry = sSkillLineAbilityStore.LookupEntry(row))
         {
-            mSkillLineAbilityMapBySpellId.insert(SkillLineAbilityMap::value_type(entry->spellId, entry));
-            mSkillLineAbilityMapBySkillId.insert(SkillLineAbilityMap::value_type(entry->skillId, entry));
+            bySpellId.emplace(entry->spellId, entry);
+            bySkillId.emplace(entry->skillId, entry);
             ++count;
         }
     }
 
+    mSkillLineAbilityMapBySpellId.Assign(bySpellId);
+    mSkillLineAbilityMapBySkillId.Assign(bySkillId);
+
     sLog.outString(">> Loaded %u SkillLineAbility MultiMaps Data", count);
     sLog.outString();
 }
@@ -3106,6 +3147,8 @@ void SpellMgr::LoadFacingCasterFlags()
         return;
     }
 
+    std::map<uint32, uint32> spellFacingFlags;
+
     BarGoLink bar(queryResult->GetRowCount());
 
     do
@@ -3123,12 +3166,14 @@ void SpellMgr::LoadFacingCasterFlags()
             sLog.outErrorDb("Spell %u listed in `spell_facing` does not exist", entry);
             continue;
         }
-        mSpellFacingFlagMap[entry]    = FacingCasterFlags;
+        spellFacingFlags[entry]    = FacingCasterFlags;
 
         ++count;
     }
     while (queryResult->NextRow());
 
+    mSpellFacingFlagMap.Assign(spellFacingFlags);
+
     sLog.outString();
     sLog.outString(">> Loaded %u facing caster flags", count);
 }
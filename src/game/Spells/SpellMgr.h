@@ -36,6 +36,7 @@
 #include "Spells/SpellAuras.h"
 #include "Server/SQLStorages.h"
 #include "Spells/SpellEffectDefines.h"
+#include "Utilities/FlatMap.h"
 
 #include <map>
 
@@ -2101,9 +2102,9 @@ struct SpellThreatEntry
     float ap_bonus;
 };
 
-typedef std::map<uint32, uint8> SpellElixirMap;
+typedef FlatMap<uint32, uint8> SpellElixirMap;
 typedef std::map<uint32, float> SpellProcItemEnchantMap;
-typedef std::map<uint32, SpellThreatEntry> SpellThreatMap;
+typedef FlatMap<uint32, SpellThreatEntry> SpellThreatMap;
 
 // Spell script target related declarations (accessed using SpellMgr functions)
 enum SpellTargetType
@@ -2214,9 +2215,9 @@ struct SpellArea
     void ApplyOrRemoveSpellIfCan(Player* player, uint32 newZone, uint32 newArea, bool onlyApply) const;
 };
 
-typedef std::multimap<uint32 /*applySpellId*/, SpellArea> SpellAreaMap;
-typedef std::multimap<uint32 /*auraSpellId*/, SpellArea const*> SpellAreaForAuraMap;
-typedef std::multimap<uint32 /*areaOrZoneId*/, SpellArea const*> SpellAreaForAreaMap;
+typedef FlatMap<uint32 /*applySpellId*/, SpellArea> SpellAreaMap;
+typedef FlatMap<uint32 /*auraSpellId*/, SpellArea const*> SpellAreaForAuraMap;
+typedef FlatMap<uint32 /*areaOrZoneId*/, SpellArea const*> SpellAreaForAreaMap;
 typedef std::pair<SpellAreaMap::const_iterator, SpellAreaMap::const_iterator> SpellAreaMapBounds;
 typedef std::pair<SpellAreaForAuraMap::const_iterator, SpellAreaForAuraMap::const_iterator>  SpellAreaForAuraMapBounds;
 typedef std::pair<SpellAreaForAreaMap::const_iterator, SpellAreaForAreaMap::const_iterator>  SpellAreaForAreaMapBounds;
@@ -2242,7 +2243,7 @@ struct SpellLearnSkillNode
     SpellEffects effect;
 };
 
-typedef std::map<uint32, SpellLearnSkillNode> SpellLearnSkillMap;
+typedef FlatMap<uint32, SpellLearnSkillNode> SpellLearnSkillMap;
 
 struct SpellLearnSpellNode
 {
@@ -2251,10 +2252,10 @@ struct SpellLearnSpellNode
     bool autoLearned;
 };
 
-typedef std::multimap<uint32, SpellLearnSpellNode> SpellLearnSpellMap;
+typedef FlatMap<uint32, SpellLearnSpellNode> SpellLearnSpellMap;
 typedef std::pair<SpellLearnSpellMap::const_iterator, SpellLearnSpellMap::const_iterator> SpellLearnSpellMapBounds;
 
-typedef std::multimap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
+typedef FlatMap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
 typedef std::pair<SkillLineAbilityMap::const_iterator, SkillLineAbilityMap::const_iterator> SkillLineAbilityMapBounds;
 
 typedef std::multimap<uint32, SkillRaceClassInfoEntry const*> SkillRaceClassInfoMap;
@@ -2272,7 +2273,7 @@ inline bool IsProfessionOrRidingSkill(uint32 skill)
     return  IsProfessionSkill(skill) || skill == SKILL_RIDING;
 }
 
-typedef std::map<uint32, uint32> SpellFacingFlagMap;
+typedef FlatMap<uint32, uint32> SpellFacingFlagMap;
 
 class SpellMgr
 {
@@ -2516,6 +2517,15 @@ class SpellMgr
             return nullptr;
         }
 
+        // Proc flags used by the proc system for spell, custom `spell_proc_event` flags override dbc ones
+        uint32 GetSpellProcFlags(SpellEntry const* spellInfo) const
+        {
+            SpellProcEventEntry const* spellProcEvent = GetSpellProcEvent(spellInfo->Id);
+            if (spellProcEvent && spellProcEvent->procFlags)
+                return spellProcEvent->procFlags;
+            return spellInfo->procFlags;
+        }
+
         // Spell procs from item enchants
         float GetItemEnchantProcChance(uint32 spellid) const
         {
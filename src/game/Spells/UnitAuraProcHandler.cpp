@@ -411,12 +411,19 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
 {
     ProcExecutionData execData(argData, isVictim);
 
+    // No holder can be triggered by these flags
+    if ((m_procHolderFlags & execData.procFlags) == 0)
+        return;
+
     ProcTriggeredList procTriggered;
     std::vector<SpellAuraHolder*> holdersForDeletion;
-    // Fill procTriggered list
-    for (SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr != GetSpellAuraHolderMap().end(); ++itr)
+    // Fill procTriggered list, only holders with matching proc flags can pass IsTriggeredAtSpellProcEvent
+    for (size_t i = 0; i < m_procHolderIndex.size(); ++i)
     {
-        SpellAuraHolder* holder = itr->second;
+        if ((m_procHolderIndex[i].procFlags & execData.procFlags) == 0)
+            continue;
+
+        SpellAuraHolder* holder = m_procHolderIndex[i].holder;
         // skip deleted auras (possible at recursive triggered call
         if (holder->GetState() != SPELLAURAHOLDER_STATE_READY || holder->IsDeleted())
             continue;
@@ -439,7 +446,7 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
         if (result != SpellProcEventTriggerCheck::SPELL_PROC_TRIGGER_OK)
             continue;
 
-        procTriggered.push_back(ProcTriggeredData(spellProcEvent, itr->second));
+        procTriggered.push_back(ProcTriggeredData(spellProcEvent, holder));
     }
 
     for (SpellAuraHolder* holder : holdersForDeletion)
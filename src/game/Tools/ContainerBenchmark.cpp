@@ -0,0 +1,463 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Tools/ContainerBenchmark.h"
+#include "Entities/ObjectGuid.h"
+#include "Utilities/EventProcessor.h"
+#include "Utilities/FlatMap.h"
+#include "Log/Log.h"
+#include "Util/OpenHashMap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+
+class WorldObject;
+
+namespace
+{
+    char const* const operationNames[] = { "insert", "find hit", "find miss", "equal range", "iterate", "erase", "modify time", "kill event", "update pop" };
+
+    template<class Work>
+    uint64 ElapsedNs(Work work)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        work();
+        return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    // folds a mapped value into the checksum, reading it like the server code does
+    uint64 Fold(uint64 const* value) { return *value; }
+    uint64 Fold(std::vector<WorldObject*> const& value) { return value.size(); }
+    uint64 Fold(uint32 value) { return value; }
+
+    class BenchmarkEvent : public BasicEvent
+    {
+        public:
+            explicit BenchmarkEvent(uint64& executed) : m_executed(executed) {}
+
+            bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override { ++m_executed; return true; }
+
+        private:
+            uint64& m_executed;
+    };
+
+    // the std::multimap queue EventProcessor used before the heap, kept as the reference to compare with
+    class MultimapEventProcessor
+    {
+        public:
+            MultimapEventProcessor() : m_time(0) {}
+
+            ~MultimapEventProcessor()
+            {
+                for (auto& itr : m_events)
+                    delete itr.second;
+            }
+
+            void Update(uint32 p_time)
+            {
+                m_time += p_time;
+
+                std::multimap<uint64, BasicEvent*>::iterator i;
+                while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+                {
+                    BasicEvent* event = i->second;
+                    m_events.erase(i);
+
+                    if (event->Execute(m_time, p_time))
+                        delete event;
+                }
+            }
+
+            void KillEvent(BasicEvent* event)
+            {
+                for (auto itr = m_events.begin(); itr != m_events.end();)
+                {
+                    if (itr->second == event)
+                    {
+                        delete itr->second;
+                        itr = m_events.erase(itr);
+                    }
+                    else
+                        ++itr;
+                }
+            }
+
+            void AddEvent(BasicEvent* event, uint64 e_time)
+            {
+                event->m_addTime = m_time;
+                event->m_execTime = e_time;
+                m_events.insert(std::pair<uint64, BasicEvent*>(e_time, event));
+            }
+
+            void ModifyEventTime(BasicEvent* event, uint64 msTime)
+            {
+                for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
+                {
+                    if (itr->second != event)
+                        continue;
+
+                    event->m_execTime = msTime;
+                    m_events.erase(itr);
+                    m_events.insert(std::pair<uint64, BasicEvent*>(msTime, event));
+                    break;
+                }
+            }
+
+            uint64 CalculateTime(uint64 t_offset) const { return m_time + t_offset; }
+
+        private:
+            uint64 m_time;
+            std::multimap<uint64, BasicEvent*> m_events;
+    };
+}
+
+ContainerBenchmark::Times::Times()
+{
+    std::fill(std::begin(best), std::end(best), std::numeric_limits<uint64>::max());
+    std::fill(std::begin(counts), std::end(counts), 0);
+}
+
+int ContainerBenchmark::Run()
+{
+    std::vector<uint32> sizes;
+    if (!ParseSizes(sizes))
+        return 1;
+
+    m_config.rounds = std::max(m_config.rounds, 1u);
+    sLog.outString("ContainerBenchmark: %u sizes, best of %u rounds, ratio below 1 means the server container is faster", uint32(sizes.size()), m_config.rounds);
+
+    for (uint32 size : sizes)
+    {
+        BenchmarkHashMaps(size);
+        BenchmarkFlatMaps(size);
+    }
+
+    BenchmarkEventQueues();
+
+    sLog.outString("ContainerBenchmark: done, checksum " UI64FMTD, m_checksum);
+    return 0;
+}
+
+bool ContainerBenchmark::ParseSizes(std::vector<uint32>& sizes) const
+{
+    std::istringstream stream(m_config.sizes);
+    std::string token;
+    while (std::getline(stream, token, ','))
+    {
+        char* end = nullptr;
+        unsigned long const size = std::strtoul(token.c_str(), &end, 10);
+        if (end == token.c_str() || *end || !size || size > 0x10000000)
+        {
+            sLog.outError("ContainerBenchmark: invalid size '%s'", token.c_str());
+            return false;
+        }
+        sizes.push_back(uint32(size));
+    }
+
+    if (sizes.empty())
+    {
+        sLog.outError("ContainerBenchmark: no sizes given");
+        return false;
+    }
+    return true;
+}
+
+void ContainerBenchmark::BenchmarkHashMaps(uint32 size)
+{
+    std::mt19937 rng(size);
+    std::vector<uint64> values(size, 1);                    // what the mapped pointers point to
+    std::vector<uint64> others(size, 1);                    // addresses of objects that are not in the map
+
+    // object accessor: players and creatures, low counters handed out in sequence
+    std::vector<ObjectGuid> guids, guidMisses;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        guids.push_back(i % 4 ? ObjectGuid(HIGHGUID_UNIT, 1000 + i % 500, i + 1) : ObjectGuid(HIGHGUID_PLAYER, i + 1));
+        guidMisses.push_back(ObjectGuid(HIGHGUID_UNIT, 1000 + i % 500, size + i + 1));
+    }
+    std::vector<ObjectGuid> guidLookups(guids);
+    std::shuffle(guidLookups.begin(), guidLookups.end(), rng);
+
+    auto const guidValue = [&values](size_t i) { return &values[i]; };
+    Times const guidOurs = TimeHashMap<MaNGOS::OpenHashMap<ObjectGuid, uint64*>>(guids, guidLookups, guidMisses, guidValue);
+    Times const guidStd = TimeHashMap<std::unordered_map<ObjectGuid, uint64*>>(guids, guidLookups, guidMisses, guidValue);
+    PrintTimes("ObjectGuid -> pointer (object accessor)", size, "OpenHashMap", guidOurs, "unordered_map", guidStd);
+
+    // map objects by db guid: sequential db guids, one object each
+    std::vector<uint64> dbGuids, dbGuidMisses;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        dbGuids.push_back(i + 1);
+        dbGuidMisses.push_back(size + i + 1);
+    }
+    std::vector<uint64> dbGuidLookups(dbGuids);
+    std::shuffle(dbGuidLookups.begin(), dbGuidLookups.end(), rng);
+
+    auto const dbGuidValue = [](size_t) { return std::vector<WorldObject*>(1, nullptr); };
+    Times const dbGuidOurs = TimeHashMap<MaNGOS::OpenHashMap<uint64, std::vector<WorldObject*>>>(dbGuids, dbGuidLookups, dbGuidMisses, dbGuidValue);
+    Times const dbGuidStd = TimeHashMap<std::unordered_map<uint64, std::vector<WorldObject*>>>(dbGuids, dbGuidLookups, dbGuidMisses, dbGuidValue);
+    PrintTimes("uint64 -> vector (map objects by db guid)", size, "OpenHashMap", dbGuidOurs, "unordered_map", dbGuidStd);
+
+    // update data per player: pointer keys of objects in one allocation
+    std::vector<uint64 const*> pointers, pointerMisses;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        pointers.push_back(&values[i]);
+        pointerMisses.push_back(&others[i]);
+    }
+    std::vector<uint64 const*> pointerLookups(pointers);
+    std::shuffle(pointerLookups.begin(), pointerLookups.end(), rng);
+
+    auto const pointerValue = [](size_t i) { return uint32(i); };
+    Times const pointerOurs = TimeHashMap<MaNGOS::OpenHashMap<uint64 const*, uint32>>(pointers, pointerLookups, pointerMisses, pointerValue);
+    Times const pointerStd = TimeHashMap<std::unordered_map<uint64 const*, uint32>>(pointers, pointerLookups, pointerMisses, pointerValue);
+    PrintTimes("pointer -> value (update data per player)", size, "OpenHashMap", pointerOurs, "unordered_map", pointerStd);
+}
+
+void ContainerBenchmark::BenchmarkFlatMaps(uint32 size)
+{
+    std::mt19937 rng(size);
+    std::vector<uint64> values(size, 1);                    // what the mapped pointers point to
+
+    // spell data by spell id (SpellFacingFlagMap and alike): one entry per spell, ids with gaps
+    std::map<uint32, uint32> spellMap;
+    std::vector<uint32> spellLookups, spellMisses;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        spellMap.emplace(2 * (i + 1), i);
+        spellLookups.push_back(2 * (i + 1));
+        spellMisses.push_back(2 * (i + 1) + 1);
+    }
+    std::shuffle(spellLookups.begin(), spellLookups.end(), rng);
+
+    FlatMap<uint32, uint32> const spellFlat(spellMap);
+    Times const spellOurs = TimeSortedMap(spellFlat, spellLookups, spellMisses);
+    Times const spellStd = TimeSortedMap(spellMap, spellLookups, spellMisses);
+    PrintTimes("uint32 -> uint32 (spell data by spell id)", size, "FlatMap", spellOurs, "map", spellStd);
+
+    // learn and skill line lookups (SpellLearnSpellMap, SkillLineAbilityMap): a few entries per key
+    std::multimap<uint32, uint64 const*> learnMap;
+    std::vector<uint32> learnLookups, learnMisses;
+    for (uint32 i = 0, key = 2; i < size; key += 2)
+    {
+        for (uint32 entries = 1 + rng() % 7; entries && i < size; --entries, ++i)
+            learnMap.emplace(key, &values[i]);
+        learnLookups.push_back(key);
+        learnMisses.push_back(key + 1);
+    }
+    std::shuffle(learnLookups.begin(), learnLookups.end(), rng);
+
+    FlatMap<uint32, uint64 const*> const learnFlat(learnMap);
+    Times const learnOurs = TimeSortedMap(learnFlat, learnLookups, learnMisses);
+    Times const learnStd = TimeSortedMap(learnMap, learnLookups, learnMisses);
+    PrintTimes("uint32 -> pointer, equal keys (spell learn/skill line)", size, "FlatMap", learnOurs, "multimap", learnStd);
+}
+
+void ContainerBenchmark::BenchmarkEventQueues()
+{
+    // every world object owns a queue, most hold a few events and busy units some dozens; the total
+    // number of events is the same for each case
+    uint32 const totalEvents = 65536;
+    uint32 const eventCounts[] = { 2, 8, 32, 128 };
+
+    for (uint32 eventsPerObject : eventCounts)
+    {
+        uint32 const objects = totalEvents / eventsPerObject;
+        Times const heap = TimeEventQueue<EventProcessor>(objects, eventsPerObject);
+        Times const multimap = TimeEventQueue<MultimapEventProcessor>(objects, eventsPerObject);
+
+        char title[64];
+        snprintf(title, sizeof(title), "event queue, %u events per object", eventsPerObject);
+        PrintTimes(title, objects * eventsPerObject, "heap", heap, "multimap", multimap);
+    }
+}
+
+template<class MapType, class Key, class MakeValue>
+ContainerBenchmark::Times ContainerBenchmark::TimeHashMap(std::vector<Key> const& keys, std::vector<Key> const& lookups, std::vector<Key> const& misses, MakeValue makeValue)
+{
+    Times times;
+    for (uint32 round = 0; round < m_config.rounds; ++round)
+    {
+        MapType map;
+        uint64 checksum = 0;
+
+        times.Keep(OP_INSERT, ElapsedNs([&]()
+        {
+            for (size_t i = 0; i < keys.size(); ++i)
+                map.emplace(keys[i], makeValue(i));
+        }), keys.size());
+
+        times.Keep(OP_FIND_HIT, ElapsedNs([&]()
+        {
+            for (Key const& key : lookups)
+            {
+                auto const itr = map.find(key);
+                if (itr != map.end())
+                    checksum += Fold(itr->second);
+            }
+        }), lookups.size());
+
+        times.Keep(OP_FIND_MISS, ElapsedNs([&]()
+        {
+            for (Key const& key : misses)
+                checksum += map.count(key);
+        }), misses.size());
+
+        times.Keep(OP_ITERATE, ElapsedNs([&]()
+        {
+            for (auto const& itr : map)
+                checksum += Fold(itr.second);
+        }), map.size());
+
+        times.Keep(OP_ERASE, ElapsedNs([&]()
+        {
+            for (Key const& key : lookups)
+                checksum += map.erase(key);
+        }), lookups.size());
+
+        m_checksum += checksum;
+    }
+    return times;
+}
+
+template<class MapType, class Key>
+ContainerBenchmark::Times ContainerBenchmark::TimeSortedMap(MapType const& map, std::vector<Key> const& lookups, std::vector<Key> const& misses)
+{
+    Times times;
+    for (uint32 round = 0; round < m_config.rounds; ++round)
+    {
+        uint64 checksum = 0;
+
+        times.Keep(OP_FIND_HIT, ElapsedNs([&]()
+        {
+            for (Key const& key : lookups)
+            {
+                auto const itr = map.find(key);
+                if (itr != map.end())
+                    checksum += Fold(itr->second);
+            }
+        }), lookups.size());
+
+        times.Keep(OP_FIND_MISS, ElapsedNs([&]()
+        {
+            for (Key const& key : misses)
+                checksum += map.find(key) != map.end();
+        }), misses.size());
+
+        times.Keep(OP_EQUAL_RANGE, ElapsedNs([&]()
+        {
+            for (Key const& key : lookups)
+            {
+                auto const bounds = map.equal_range(key);
+                for (auto itr = bounds.first; itr != bounds.second; ++itr)
+                    checksum += Fold(itr->second);
+            }
+        }), lookups.size());
+
+        times.Keep(OP_ITERATE, ElapsedNs([&]()
+        {
+            for (auto const& itr : map)
+                checksum += Fold(itr.second);
+        }), map.size());
+
+        m_checksum += checksum;
+    }
+    return times;
+}
+
+template<class Processor>
+ContainerBenchmark::Times ContainerBenchmark::TimeEventQueue(uint32 objects, uint32 eventsPerObject)
+{
+    uint32 const maxDelay = 60000;
+    uint32 const events = objects * eventsPerObject;
+
+    Times times;
+    for (uint32 round = 0; round < m_config.rounds; ++round)
+    {
+        std::mt19937 rng(eventsPerObject);
+        std::vector<uint64> delays(events), newDelays(events);
+        for (uint32 i = 0; i < events; ++i)
+        {
+            delays[i] = rng() % maxDelay;
+            newDelays[i] = rng() % maxDelay;
+        }
+
+        uint64 executed = 0;
+        std::vector<BasicEvent*> queued(events);
+        for (BasicEvent*& event : queued)
+            event = new BenchmarkEvent(executed);
+
+        std::vector<Processor> processors(objects);
+
+        times.Keep(OP_INSERT, ElapsedNs([&]()
+        {
+            for (uint32 i = 0; i < events; ++i)
+            {
+                Processor& processor = processors[i / eventsPerObject];
+                processor.AddEvent(queued[i], processor.CalculateTime(delays[i]));
+            }
+        }), events);
+
+        times.Keep(OP_MODIFY_TIME, ElapsedNs([&]()
+        {
+            for (uint32 i = 0; i < events; ++i)
+            {
+                Processor& processor = processors[i / eventsPerObject];
+                processor.ModifyEventTime(queued[i], processor.CalculateTime(newDelays[i]));
+            }
+        }), events);
+
+        // every other event is killed, the rest is executed by the update
+        times.Keep(OP_KILL_EVENT, ElapsedNs([&]()
+        {
+            for (uint32 i = 0; i < events; i += 2)
+                processors[i / eventsPerObject].KillEvent(queued[i]);
+        }), events / 2);
+
+        times.Keep(OP_UPDATE, ElapsedNs([&]()
+        {
+            for (Processor& processor : processors)
+                processor.Update(maxDelay);
+        }), events - events / 2);
+
+        m_checksum += executed;
+    }
+    return times;
+}
+
+void ContainerBenchmark::PrintTimes(char const* title, uint32 size, char const* ours, Times const& ourTimes, char const* theirs, Times const& theirTimes) const
+{
+    sLog.outString("%s, %u elements, ns per operation (per element for iterate)", title, size);
+    sLog.outString("    %-12s %14s %14s %8s", "", ours, theirs, "ratio");
+    for (uint32 op = 0; op < MAX_OPERATIONS; ++op)
+    {
+        if (!ourTimes.counts[op] || !theirTimes.counts[op])
+            continue;
+
+        double const ourNs = double(ourTimes.best[op]) / ourTimes.counts[op];
+        double const theirNs = double(theirTimes.best[op]) / theirTimes.counts[op];
+        sLog.outString("    %-12s %14.2f %14.2f %8.2f", operationNames[op], ourNs, theirNs, theirNs > 0.0 ? ourNs / theirNs : 0.0);
+    }
+}
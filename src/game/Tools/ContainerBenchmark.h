@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_CONTAINERBENCHMARK_H
+#define MANGOS_CONTAINERBENCHMARK_H
+
+#include "Common.h"
+
+#include <string>
+#include <vector>
+
+struct ContainerBenchmarkConfig
+{
+    ContainerBenchmarkConfig() : enabled(false), rounds(10), sizes("64,4096,262144") {}
+
+    bool enabled;
+    uint32 rounds;                                          // best of this many rounds is reported
+    std::string sizes;                                      // element counts, comma separated
+};
+
+/*
+  @class ContainerBenchmark
+  Headless microbenchmark of the server containers against the std ones they replace, run by
+  mangosd --containerbench before anything is loaded. Each case uses the key and value types of a map
+  that adopted the container and reports the best time per operation over the configured rounds.
+  Hash maps are compared with std::unordered_map, frozen FlatMaps with the std::map/std::multimap
+  they are built from and the heap ordered EventProcessor queue with the std::multimap queue it replaced.
+ */
+class ContainerBenchmark
+{
+    public:
+        explicit ContainerBenchmark(ContainerBenchmarkConfig const& config) : m_config(config), m_checksum(0) {}
+
+        // process exit code, 0 if all cases ran
+        int Run();
+
+    private:
+        enum Operation
+        {
+            OP_INSERT,
+            OP_FIND_HIT,
+            OP_FIND_MISS,
+            OP_EQUAL_RANGE,
+            OP_ITERATE,
+            OP_ERASE,
+            OP_MODIFY_TIME,
+            OP_KILL_EVENT,
+            OP_UPDATE,
+            MAX_OPERATIONS
+        };
+
+        struct Times
+        {
+            Times();
+
+            void Keep(Operation op, uint64 ns, uint64 count) { if (ns < best[op]) best[op] = ns; counts[op] = count; }
+
+            uint64 best[MAX_OPERATIONS];                    // ns, or max for operations that were not timed
+            uint64 counts[MAX_OPERATIONS];                  // operations per timed run
+        };
+
+        bool ParseSizes(std::vector<uint32>& sizes) const;
+
+        void BenchmarkHashMaps(uint32 size);
+        void BenchmarkFlatMaps(uint32 size);
+        void BenchmarkEventQueues();
+
+        template<class MapType, class Key, class MakeValue>
+        Times TimeHashMap(std::vector<Key> const& keys, std::vector<Key> const& lookups, std::vector<Key> const& misses, MakeValue makeValue);
+
+        template<class MapType, class Key>
+        Times TimeSortedMap(MapType const& map, std::vector<Key> const& lookups, std::vector<Key> const& misses);
+
+        template<class Processor>
+        Times TimeEventQueue(uint32 objects, uint32 eventsPerObject);
+
+        void PrintTimes(char const* title, uint32 size, char const* ours, Times const& ourTimes, char const* theirs, Times const& theirTimes) const;
+
+        ContainerBenchmarkConfig m_config;
+        uint64 m_checksum;                                  // folded results, keeps the timed work from being optimized out
+};
+
+#endif
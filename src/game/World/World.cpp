@@ -29,6 +29,7 @@
 #include "Server/Opcodes.h"
 #include "Server/WorldSession.h"
 #include "Server/WorldPacket.h"
+#include "Server/OpcodeStats.h"
 #include "Entities/Player.h"
 #include "Accounts/AccountMgr.h"
 #include "AuctionHouse/AuctionHouseMgr.h"
@@ -44,6 +45,7 @@
 #include "Loot/LootMgr.h"
 #include "Entities/ItemEnchantmentMgr.h"
 #include "Maps/MapManager.h"
+#include "Maps/MapWorkers.h"
 #include "DBScripts/ScriptMgr.h"
 #include "AI/CreatureAIRegistry.h"
 #include "Policies/Singleton.h"
@@ -62,6 +64,7 @@
 #include "Util/Util.h"
 #include "Tools/CharacterDatabaseCleaner.h"
 #include "Entities/CreatureLinkingMgr.h"
+#include "Entities/DynamicObject.h"
 #include "Weather/Weather.h"
 #include "Cinematics/CinematicMgr.h"
 #include "World/WorldState.h"
@@ -173,6 +176,8 @@ void World::CleanupsBeforeStop()
 
     KickAll(true);                                   // save and kick all players
     UpdateSessions(1);                               // real players unload required UpdateSessions call
+    if (m_sessionUpdater.activated())
+        m_sessionUpdater.deactivate();
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
     sMapMgr.UnloadAll();                             // unload all grids (including locked in memory)
 }
@@ -499,6 +504,13 @@ void World::LoadConfigSettings(bool reload)
     if (reload)
         sMapMgr.SetGridCleanUpDelay(getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN));
 
+    setConfig(CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD, "GridPreload.LookAhead", 5 * IN_MILLISECONDS);
+    setConfig(CONFIG_UINT32_GRID_PRELOAD_MAX_PER_TICK, "GridPreload.MaxGridsPerTick", 1);
+
+    setConfig(CONFIG_BOOL_UPDATE_LOD, "UpdateLod.Enable", false);
+    setConfigMin(CONFIG_UINT32_UPDATE_LOD_DISTANCE, "UpdateLod.Distance", 100, 1);
+    setConfigMinMax(CONFIG_UINT32_UPDATE_LOD_MAX_TIER, "UpdateLod.MaxTier", 3, 0, 7);
+
     setConfigMin(CONFIG_UINT32_INTERVAL_MAPUPDATE, "MapUpdateInterval", 100, MIN_MAP_UPDATE_DELAY);
     if (reload)
         sMapMgr.SetMapUpdateInterval(getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
@@ -616,6 +628,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_UINT32_NUM_MAP_THREADS, "MapUpdate.Threads", 3);
+    setConfig(CONFIG_UINT32_SESSION_UPDATE_THREADS, "SessionUpdate.Threads", 0);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_ORANGE, "SkillChance.Orange", 100);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_YELLOW, "SkillChance.Yellow", 75);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_GREEN,  "SkillChance.Green",  25);
@@ -708,6 +721,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_BOOL_OUTDOORPVP_EP_ENABLED,                       "OutdoorPvp.EPEnabled", true);
 
     setConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET, "Network.KickOnBadPacket", false);
+    sOpcodeStats.LoadRateBudgets(sConfig.GetIntDefault("PacketRate.DefaultBudget", 0), sConfig.GetStringDefault("PacketRate.Budgets"));
 
     setConfig(CONFIG_BOOL_PLAYER_COMMANDS, "PlayerCommands", true);
 
@@ -736,6 +750,9 @@ void World::LoadConfigSettings(bool reload)
     m_relocation_ai_notify_delay = sConfig.GetIntDefault("Visibility.AIRelocationNotifyDelay", 1000u);
     m_relocation_lower_limit_sq = pow(sConfig.GetFloatDefault("Visibility.RelocationLowerLimit", 10), 2);
 
+    setConfig(CONFIG_BOOL_MOVEMENT_RELAY, "Visibility.MovementRelay", true);
+    setConfig(CONFIG_UINT32_MOVEMENT_RELAY_INTERVAL, "Visibility.MovementRelayInterval", 0);
+
     // Visibility on Continents
     m_MaxVisibleDistanceOnContinents      = sConfig.GetFloatDefault("Visibility.Distance.Continents",     DEFAULT_VISIBILITY_DISTANCE);
     if (m_MaxVisibleDistanceOnContinents < 45 * getConfig(CONFIG_FLOAT_RATE_CREATURE_AGGRO))
@@ -1355,6 +1372,9 @@ void World::SetInitialWorldSettings()
     sMapMgr.Initialize();
     sLog.outString();
 
+    if (uint32 sessionThreads = getConfig(CONFIG_UINT32_SESSION_UPDATE_THREADS))
+        m_sessionUpdater.activate(sessionThreads);
+
     ///- Initialize Battlegrounds
     sLog.outString("Starting BattleGround System");
     sBattleGroundMgr.CreateInitialBattleGrounds();
@@ -2130,6 +2150,10 @@ void World::UpdateSessions(uint32 diff)
             AddSession_(session);
     }
 
+    ///- Let the session workers handle the thread safe packets first
+    if (m_sessionUpdater.activated())
+        UpdateSessionsParallel();
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(); itr != m_sessions.end();)
     {
@@ -2148,6 +2172,46 @@ void World::UpdateSessions(uint32 diff)
     }
 }
 
+class SessionUpdateWorker : public Worker
+{
+    public:
+        SessionUpdateWorker(std::vector<WorldSession*> const& sessions, std::atomic<size_t>& next, MapUpdater& updater) :
+            Worker(updater), m_sessions(sessions), m_next(next)
+        {}
+
+        void execute() override
+        {
+            for (size_t i = m_next++; i < m_sessions.size(); i = m_next++)
+                m_sessions[i]->UpdateParallel();
+
+            GetWorker().update_finished();
+        }
+
+    private:
+        std::vector<WorldSession*> const& m_sessions;
+        std::atomic<size_t>& m_next;
+};
+
+void World::UpdateSessionsParallel()
+{
+    // usually only a few sessions have work, in idle ticks no worker is started at all
+    m_parallelSessions.clear();
+    for (auto& session : m_sessions)
+        if (session.second->HasParallelWork())
+            m_parallelSessions.push_back(session.second);
+
+    if (m_parallelSessions.empty())
+        return;
+
+    // workers pull sessions one by one, so a session with many queued packets does not hold back a whole chunk
+    std::atomic<size_t> next(0);
+    size_t const workers = std::min<size_t>(getConfig(CONFIG_UINT32_SESSION_UPDATE_THREADS), m_parallelSessions.size());
+    for (size_t i = 0; i < workers; ++i)
+        m_sessionUpdater.schedule_update(new SessionUpdateWorker(m_parallelSessions, next, m_sessionUpdater));
+
+    m_sessionUpdater.wait();
+}
+
 void World::ServerMaintenanceStart()
 {
     uint32 LastWeekEnd    = GetDateLastMaintenanceDay();
@@ -2564,6 +2628,23 @@ void World::GeneratePacketMetrics()
         m_opcodeCounters[i] = 0;
     }
 
+    // totals since startup (or .server opcodestats reset)
+    for (OpcodeStatsEntry const& entry : sOpcodeStats.GetEntries())
+    {
+        metric::measurement meas("world.metrics.opcodes", { {"opcode", opcodeTable[entry.opcode].name} });
+        meas.add_field("received", std::to_string(entry.received));
+        meas.add_field("bytes_in", std::to_string(entry.bytesIn));
+        meas.add_field("executed", std::to_string(entry.executed));
+        meas.add_field("handler_us", std::to_string(entry.handlerTotal));
+        meas.add_field("handler_p95_us", std::to_string(OpcodeStatsEntry::Percentile(entry.handlerBuckets, 95)));
+        meas.add_field("handler_max_us", std::to_string(entry.handlerMax));
+        meas.add_field("wait_us", std::to_string(entry.waitTotal));
+        meas.add_field("wait_p95_us", std::to_string(OpcodeStatsEntry::Percentile(entry.waitBuckets, 95)));
+        meas.add_field("sent", std::to_string(entry.sent));
+        meas.add_field("bytes_out", std::to_string(entry.bytesOut));
+        meas.add_field("over_budget", std::to_string(entry.overBudget));
+    }
+
     metric::measurement meas_players("world.metrics.players");
     meas_players.add_field("online", std::to_string(GetActiveSessionCount()));
     meas_players.add_field("unique", std::to_string(GetUniqueSessionCount()));
@@ -2594,6 +2675,42 @@ void World::GeneratePacketMetrics()
 
     metric::measurement meas_latency("world.metrics.latency");
     meas_latency.add_field("online", std::to_string(GetAverageLatency()));
+
+    GeneratePoolMetrics("creature", Creature::GetPoolStats());
+    GeneratePoolMetrics("gameobject", GameObject::GetPoolStats());
+    GeneratePoolMetrics("dynamicobject", DynamicObject::GetPoolStats());
+    GeneratePoolMetrics("values", Object::GetValuesArrayPoolStats());
+
+    MovementRelayStats const relayStats = MovementRelay::GetAndResetStats();
+    metric::measurement meas_relay("world.metrics.movement_relay");
+    meas_relay.add_field("queued", std::to_string(relayStats.queued));
+    meas_relay.add_field("coalesced", std::to_string(relayStats.coalesced));
+    meas_relay.add_field("sent", std::to_string(relayStats.sent));
+
+    GenerateRegistryMetrics("player", HashMapHolder<Player>::GetAndResetStats());
+    GenerateRegistryMetrics("corpse", HashMapHolder<Corpse>::GetAndResetStats());
+}
+
+void World::GenerateRegistryMetrics(char const* type, HashMapHolderStats const& stats)
+{
+    metric::measurement meas("world.metrics.object_accessor", { {"type", type} });
+    meas.add_field("published", std::to_string(stats.published));
+    meas.add_field("reader_retries", std::to_string(stats.readerRetries));
+    meas.add_field("lock_wait_us", std::to_string(stats.lockWaitUs));
+    meas.add_field("sync_wait_us", std::to_string(stats.syncWaitUs));
+    meas.add_field("size", std::to_string(stats.size));
+}
+
+void World::GeneratePoolMetrics(char const* type, ObjectPoolStats const& stats)
+{
+    metric::measurement meas("world.metrics.pools", { {"type", type} });
+    meas.add_field("allocations", std::to_string(stats.allocations));
+    meas.add_field("reused", std::to_string(stats.reused));
+    meas.add_field("unpooled", std::to_string(stats.unpooled));
+    meas.add_field("used", std::to_string(stats.used));
+    meas.add_field("free", std::to_string(stats.free));
+    meas.add_field("slabs", std::to_string(stats.slabs));
+    meas.add_field("released", std::to_string(stats.released));
 }
 
 uint32 World::GetAverageLatency() const
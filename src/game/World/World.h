@@ -31,6 +31,7 @@
 #include "Multithreading/Messager.h"
 #include "Globals/GraveyardManager.h"
 #include "LFG/LFGQueue.h"
+#include "Maps/MapUpdater.h"
 
 #include <set>
 #include <list>
@@ -43,6 +44,8 @@
 
 class Object;
 class ObjectGuid;
+struct ObjectPoolStats;
+struct HashMapHolderStats;
 class WorldPacket;
 class WorldSession;
 class Player;
@@ -140,6 +143,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_NUM_MAP_THREADS,
+    CONFIG_UINT32_SESSION_UPDATE_THREADS,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_SKILL_CHANCE_ORANGE,
     CONFIG_UINT32_SKILL_CHANCE_YELLOW,
@@ -198,6 +202,11 @@ enum eConfigUInt32Values
     CONFIG_UINT32_CREATURE_PICKPOCKET_RESTOCK_DELAY,
     CONFIG_UINT32_CHANNEL_STATIC_AUTO_TRESHOLD,
     CONFIG_UINT32_LFG_MATCHMAKING_TIMER,
+    CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_UINT32_GRID_PRELOAD_MAX_PER_TICK,
+    CONFIG_UINT32_MOVEMENT_RELAY_INTERVAL,
+    CONFIG_UINT32_UPDATE_LOD_DISTANCE,
+    CONFIG_UINT32_UPDATE_LOD_MAX_TIER,
     CONFIG_UINT32_VALUE_COUNT
 };
 
@@ -350,6 +359,8 @@ enum eConfigBoolValues
     CONFIG_BOOL_PATH_FIND_NORMALIZE_Z,
     CONFIG_BOOL_LFG_MATCHMAKING,
     CONFIG_BOOL_DISABLE_INSTANCE_RELOCATE,
+    CONFIG_BOOL_MOVEMENT_RELAY,
+    CONFIG_BOOL_UPDATE_LOD,
     CONFIG_BOOL_VALUE_COUNT
 };
 
@@ -431,6 +442,8 @@ class World
         void CleanupsBeforeStop();
 
         WorldSession* FindSession(uint32 id) const;
+        // SessionUpdate.Threads workers are running, see WorldSession::UpdateParallel
+        bool HasSessionWorkers() { return m_sessionUpdater.activated(); }
         void AddSession(WorldSession* s);
         bool RemoveSession(uint32 id);
         /// Get the number of current active sessions
@@ -645,6 +658,8 @@ class World
 #ifdef BUILD_METRICS
         void GeneratePacketMetrics(); // thread safe due to atomics
         uint32 GetAverageLatency() const;
+        void GeneratePoolMetrics(char const* type, ObjectPoolStats const& stats);
+        void GenerateRegistryMetrics(char const* type, HashMapHolderStats const& stats);
 #endif
 
     private:
@@ -722,6 +737,12 @@ class World
         std::mutex m_sessionAddQueueLock;
         std::deque<WorldSession*> m_sessionAddQueue;
 
+        // thread safe packets and character lists of the sessions that have some, handled by SessionUpdate.Threads workers
+        void UpdateSessionsParallel();
+
+        MapUpdater m_sessionUpdater;
+        std::vector<WorldSession*> m_parallelSessions;      // reused between ticks
+
         // used versions
         std::string m_DBVersion;
         std::string m_CreatureEventAIVersion;
@@ -64,6 +64,7 @@ void WorldStateVariableManager::SetVariable(int32 Id, int32 value)
         return;
 
     variable.value = value;
+    m_owner->GetConditionCache().Invalidate();
     if (m_variables[Id].send)
         BroadcastVariable(Id);
 }
@@ -41,6 +41,7 @@
 
 #include <iostream>
 #include <string>
+#include <thread>
 
 #ifdef _WIN32
 #include "Platform/ServiceWin32.h"
@@ -69,6 +70,8 @@ uint32 realmID;                                             ///< Id of the realm
 int main(int argc, char* argv[])
 {
     std::string auctionBotConfig, configFile, playerBotConfig, serviceParameter;
+    LootSimulatorConfig lootSimulation;
+    ContainerBenchmarkConfig containerBenchmark;
 
     boost::program_options::options_description desc("Allowed options");
     desc.add_options()
@@ -77,6 +80,14 @@ int main(int argc, char* argv[])
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     ("playerbot,p", boost::program_options::value<std::string>(&playerBotConfig)->default_value(_D_PLAYERBOT_CONFIG), "playerbot configuration file")
 #endif
+    ("lootsim", boost::program_options::value<std::string>(&lootSimulation.targets), "simulate loot rolls instead of running the world, comma separated store:lootId or store:all")
+    ("lootsim-rolls", boost::program_options::value<uint32>(&lootSimulation.rolls)->default_value(100000), "loot simulation rolls per loot id")
+    ("lootsim-threads", boost::program_options::value<uint32>(&lootSimulation.threads)->default_value(std::max(std::thread::hardware_concurrency(), 1u)), "loot simulation threads")
+    ("lootsim-output", boost::program_options::value<std::string>(&lootSimulation.output), "loot simulation report file")
+    ("lootsim-baseline", boost::program_options::value<std::string>(&lootSimulation.baseline), "loot simulation report of another build to compare with")
+    ("containerbench", boost::program_options::bool_switch(&containerBenchmark.enabled), "benchmark the server containers against the std ones instead of running the world")
+    ("containerbench-sizes", boost::program_options::value<std::string>(&containerBenchmark.sizes)->default_value(containerBenchmark.sizes), "container benchmark element counts, comma separated")
+    ("containerbench-rounds", boost::program_options::value<uint32>(&containerBenchmark.rounds)->default_value(containerBenchmark.rounds), "container benchmark rounds, the best is reported")
     ("help,h", "prints usage")
     ("version,v", "print version and exit")
 #ifdef _WIN32
@@ -116,6 +127,12 @@ int main(int argc, char* argv[])
     if (vm.count("ahbot"))
         sAuctionHouseBot.SetConfigFileName(auctionBotConfig);
 
+    if (vm.count("lootsim"))
+        sMaster.SetLootSimulation(lootSimulation);
+
+    if (containerBenchmark.enabled)
+        sMaster.SetContainerBenchmark(containerBenchmark);
+
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     if (vm.count("playerbot"))
         _PLAYERBOT_CONFIG = playerBotConfig;
@@ -100,6 +100,13 @@ class FreezeDetectorRunnable : public MaNGOS::Runnable
 /// Main function
 int Master::Run()
 {
+    ///- Headless container benchmark, needs neither the databases nor the world
+    if (m_containerBenchmark.enabled)
+    {
+        m_canBeKilled = true;
+        return ContainerBenchmark(m_containerBenchmark).Run();
+    }
+
     /// worldd PID file creation
     std::string pidfile = sConfig.GetStringDefault("PidFile");
     if (!pidfile.empty())
@@ -125,6 +132,20 @@ int Master::Run()
     ///- Initialize the World
     sWorld.SetInitialWorldSettings();
 
+    ///- Headless loot simulation, the world is loaded but not run
+    if (!m_lootSimulation.targets.empty())
+    {
+        int const exitCode = LootSimulator(m_lootSimulation).Run();
+
+        CharacterDatabase.HaltDelayThread();
+        WorldDatabase.HaltDelayThread();
+        LoginDatabase.HaltDelayThread();
+        LogsDatabase.HaltDelayThread();
+
+        m_canBeKilled = true;
+        return exitCode;
+    }
+
 #ifndef _WIN32
     detachDaemon();
 #endif
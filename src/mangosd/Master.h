@@ -25,6 +25,8 @@
 
 #include "Common.h"
 #include "Policies/Singleton.h"
+#include "Loot/LootSimulator.h"
+#include "Tools/ContainerBenchmark.h"
 
 #include <boost/asio.hpp>
 
@@ -35,6 +37,11 @@ class Master
         int Run();
         static volatile bool m_canBeKilled;
 
+        // run a loot simulation after loading instead of the world
+        void SetLootSimulation(LootSimulatorConfig const& config) { m_lootSimulation = config; }
+        // run the container benchmark instead of loading anything
+        void SetContainerBenchmark(ContainerBenchmarkConfig const& config) { m_containerBenchmark = config; }
+
     private:
         bool _StartDB();
 
@@ -46,6 +53,9 @@ class Master
 
         boost::asio::io_service m_service;
         boost::asio::io_service m_raService;
+
+        LootSimulatorConfig m_lootSimulation;
+        ContainerBenchmarkConfig m_containerBenchmark;
 };
 
 #define sMaster MaNGOS::Singleton<Master>::Instance()
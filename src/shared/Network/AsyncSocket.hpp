@@ -25,6 +25,8 @@
 #include "boost/lexical_cast.hpp"
 #include "Log/Log.h"
 
+#include <array>
+
 namespace MaNGOS
 {
     // this socket is different in that it does not block on reads
@@ -39,6 +41,8 @@ namespace MaNGOS
             void ReadUntil(std::string& buffer, char delimiter, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
             void ReadSkip(size_t skipSize, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
             void Write(const char* buffer, size_t length, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
+            // gather write of two buffers as one operation
+            void Write(const char* head, size_t headLength, const char* body, size_t bodyLength, std::function<void(const boost::system::error_code&, std::size_t)>&& callback);
 
             bool Start();
             void Close()
@@ -114,6 +118,13 @@ namespace MaNGOS
         boost::asio::async_write(m_socket, boost::asio::buffer(buffer, length), callback);
     }
 
+    template <typename SocketType>
+    void MaNGOS::AsyncSocket<SocketType>::Write(const char* head, size_t headLength, const char* body, size_t bodyLength, std::function<void(const boost::system::error_code&, std::size_t)>&& callback)
+    {
+        std::array<boost::asio::const_buffer, 2> buffers = { boost::asio::buffer(head, headLength), boost::asio::buffer(body, bodyLength) };
+        boost::asio::async_write(m_socket, buffers, callback);
+    }
+
     template <typename SocketType>
     bool MaNGOS::AsyncSocket<SocketType>::AsyncSocket::Start()
     {
@@ -0,0 +1,385 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OPENHASHMAP_H
+#define MANGOS_OPENHASHMAP_H
+
+#include "Platform/Define.h"
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MaNGOS
+{
+    /*
+      @class OpenHashTable
+      Open addressing hash table with linear probing over one flat slot array, for small keys like ObjectGuid,
+      integers and pointers on hot lookup paths. A control byte per slot tells empty, erased and used slots
+      apart, so keys need no reserved values and erasing keeps iterators to other elements valid. The hash is
+      spread by a multiplicative mix, std::hash of guids, integers and pointers is the identity.
+      Interface is the used subset of std::unordered_map / std::unordered_set; inserting may rehash and then
+      invalidates all iterators, and iteration order is unspecified.
+      Unlike std::unordered_map, elements live in the slot array itself: any insert (insert, emplace,
+      try_emplace, operator[]) that rehashes the table moves them, so references and pointers to elements are
+      invalidated too. Do not keep an element reference across an insert into the same map.
+     */
+    template<class Key, class Stored, class KeyOf, class Hash, class KeyEqual>
+    class OpenHashTable
+    {
+        protected:
+            enum SlotState : uint8
+            {
+                SLOT_EMPTY   = 0,
+                SLOT_ERASED  = 1,
+                SLOT_USED    = 2,
+            };
+
+            typedef typename std::remove_const<Stored>::type StorageType;
+
+        public:
+            typedef Key key_type;
+            typedef StorageType value_type;
+            typedef std::size_t size_type;
+
+            template<bool IsConst>
+            class Iterator
+            {
+                    friend class OpenHashTable;
+                    typedef typename std::conditional<IsConst, OpenHashTable const*, OpenHashTable*>::type TablePtr;
+
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef StorageType value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef typename std::conditional<IsConst, Stored const*, Stored*>::type pointer;
+                    typedef typename std::conditional<IsConst, Stored const&, Stored&>::type reference;
+
+                    Iterator() : m_table(nullptr), m_index(0) {}
+                    // iterator to const_iterator
+                    template<bool OtherConst, class = typename std::enable_if<IsConst && !OtherConst>::type>
+                    Iterator(Iterator<OtherConst> const& other) : m_table(other.m_table), m_index(other.m_index) {}
+
+                    reference operator*() const { return m_table->m_slots[m_index]; }
+                    pointer operator->() const { return &m_table->m_slots[m_index]; }
+
+                    Iterator& operator++() { ++m_index; SkipUnused(); return *this; }
+                    Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+
+                    bool operator==(Iterator const& other) const { return m_index == other.m_index && m_table == other.m_table; }
+                    bool operator!=(Iterator const& other) const { return !(*this == other); }
+
+                private:
+                    template<bool> friend class Iterator;
+
+                    Iterator(TablePtr table, size_type index) : m_table(table), m_index(index) {}
+
+                    void SkipUnused()
+                    {
+                        while (m_index < m_table->m_capacity && m_table->m_states[m_index] != SLOT_USED)
+                            ++m_index;
+                    }
+
+                    TablePtr m_table;
+                    size_type m_index;
+            };
+
+            typedef Iterator<false> iterator;
+            typedef Iterator<true> const_iterator;
+
+            OpenHashTable() : m_states(nullptr), m_slots(nullptr), m_capacity(0), m_size(0), m_erased(0), m_shift(64) {}
+
+            OpenHashTable(OpenHashTable const& other) : OpenHashTable()
+            {
+                if (!other.m_size)
+                    return;
+
+                Allocate(other.m_capacity);
+                std::memcpy(m_states, other.m_states, m_capacity);
+                for (size_type i = 0; i < m_capacity; ++i)
+                    if (m_states[i] == SLOT_USED)
+                        new (&m_slots[i]) StorageType(other.m_slots[i]);
+                m_size = other.m_size;
+                m_erased = other.m_erased;
+            }
+
+            OpenHashTable(OpenHashTable&& other) noexcept : OpenHashTable() { Swap(other); }
+
+            OpenHashTable& operator=(OpenHashTable other) { Swap(other); return *this; }
+
+            ~OpenHashTable()
+            {
+                DestroyAll();
+                Deallocate();
+            }
+
+            iterator begin() { iterator itr(this, 0); itr.SkipUnused(); return itr; }
+            iterator end() { return iterator(this, m_capacity); }
+            const_iterator begin() const { const_iterator itr(this, 0); itr.SkipUnused(); return itr; }
+            const_iterator end() const { return const_iterator(this, m_capacity); }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            bool empty() const { return m_size == 0; }
+            size_type size() const { return m_size; }
+
+            iterator find(Key const& key) { return iterator(this, FindIndex(key)); }
+            const_iterator find(Key const& key) const { return const_iterator(this, FindIndex(key)); }
+            size_type count(Key const& key) const { return FindIndex(key) != m_capacity ? 1 : 0; }
+
+            std::pair<iterator, bool> insert(StorageType const& value) { return Emplace(KeyOf()(value), value); }
+            std::pair<iterator, bool> insert(StorageType&& value) { return Emplace(KeyOf()(value), std::move(value)); }
+
+            template<class InputIt>
+            void insert(InputIt first, InputIt last)
+            {
+                for (; first != last; ++first)
+                    insert(*first);
+            }
+
+            template<class... Args>
+            std::pair<iterator, bool> emplace(Args&&... args)
+            {
+                StorageType value(std::forward<Args>(args)...);
+                return Emplace(KeyOf()(value), std::move(value));
+            }
+
+            iterator erase(const_iterator pos)
+            {
+                size_type const index = pos.m_index;
+                EraseIndex(index);
+                iterator next(this, index + 1);
+                next.SkipUnused();
+                return next;
+            }
+
+            size_type erase(Key const& key)
+            {
+                size_type const index = FindIndex(key);
+                if (index == m_capacity)
+                    return 0;
+
+                EraseIndex(index);
+                return 1;
+            }
+
+            void clear()
+            {
+                DestroyAll();
+                if (m_capacity)
+                    std::memset(m_states, SLOT_EMPTY, m_capacity);
+                m_size = 0;
+                m_erased = 0;
+            }
+
+            void reserve(size_type count)
+            {
+                size_type const capacity = CapacityFor(count);
+                if (capacity > m_capacity)
+                    Rehash(capacity);
+            }
+
+            void swap(OpenHashTable& other) { Swap(other); }
+
+        protected:
+            // slot for an absent key, the caller constructs the element there
+            template<class... Args>
+            std::pair<iterator, bool> Emplace(Key const& key, Args&&... args)
+            {
+                size_type index = FindIndex(key);
+                if (index != m_capacity)
+                    return std::make_pair(iterator(this, index), false);
+
+                // used and erased slots stay below 7/8 so probing always meets an empty slot
+                if ((m_size + m_erased + 1) * 8 > m_capacity * 7)
+                    Rehash(CapacityFor(m_size + 1));
+
+                index = HomeIndex(key);
+                while (m_states[index] == SLOT_USED)
+                    index = (index + 1) & (m_capacity - 1);
+
+                if (m_states[index] == SLOT_ERASED)
+                    --m_erased;
+
+                new (&m_slots[index]) StorageType(std::forward<Args>(args)...);
+                m_states[index] = SLOT_USED;
+                ++m_size;
+                return std::make_pair(iterator(this, index), true);
+            }
+
+        private:
+            static size_type CapacityFor(size_type count)
+            {
+                size_type capacity = 16;
+                while (count * 16 > capacity * 7)                // a grown table is at most 7/16 full
+                    capacity *= 2;
+                return capacity;
+            }
+
+            size_type HomeIndex(Key const& key) const
+            {
+                return size_type((uint64(Hash()(key)) * 0x9E3779B97F4A7C15ULL) >> m_shift);
+            }
+
+            size_type FindIndex(Key const& key) const
+            {
+                if (!m_size)
+                    return m_capacity;
+
+                size_type index = HomeIndex(key);
+                while (m_states[index] != SLOT_EMPTY)
+                {
+                    if (m_states[index] == SLOT_USED && KeyEqual()(KeyOf()(m_slots[index]), key))
+                        return index;
+                    index = (index + 1) & (m_capacity - 1);
+                }
+                return m_capacity;
+            }
+
+            void EraseIndex(size_type index)
+            {
+                m_slots[index].~StorageType();
+                --m_size;
+
+                // no probe sequence continues past an empty successor, so the slot can be empty again
+                if (m_states[(index + 1) & (m_capacity - 1)] == SLOT_EMPTY)
+                    m_states[index] = SLOT_EMPTY;
+                else
+                {
+                    m_states[index] = SLOT_ERASED;
+                    ++m_erased;
+                }
+            }
+
+            void Rehash(size_type capacity)
+            {
+                uint8* oldStates = m_states;
+                StorageType* oldSlots = m_slots;
+                size_type const oldCapacity = m_capacity;
+
+                Allocate(capacity);
+                m_erased = 0;
+
+                for (size_type i = 0; i < oldCapacity; ++i)
+                {
+                    if (oldStates[i] != SLOT_USED)
+                        continue;
+
+                    size_type index = HomeIndex(KeyOf()(oldSlots[i]));
+                    while (m_states[index] == SLOT_USED)
+                        index = (index + 1) & (m_capacity - 1);
+
+                    new (&m_slots[index]) StorageType(std::move(oldSlots[i]));
+                    m_states[index] = SLOT_USED;
+                    oldSlots[i].~StorageType();
+                }
+
+                delete[] oldStates;
+                ::operator delete(oldSlots);
+            }
+
+            void Allocate(size_type capacity)
+            {
+                m_states = new uint8[capacity];
+                std::memset(m_states, SLOT_EMPTY, capacity);
+                m_slots = static_cast<StorageType*>(::operator new(capacity * sizeof(StorageType)));
+                m_capacity = capacity;
+
+                m_shift = 64;
+                for (size_type bits = capacity; bits > 1; bits >>= 1)
+                    --m_shift;
+            }
+
+            void Deallocate()
+            {
+                delete[] m_states;
+                ::operator delete(m_slots);
+                m_states = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_shift = 64;
+            }
+
+            void DestroyAll()
+            {
+                if (std::is_trivially_destructible<StorageType>::value)
+                    return;
+
+                for (size_type i = 0; i < m_capacity; ++i)
+                    if (m_states[i] == SLOT_USED)
+                        m_slots[i].~StorageType();
+            }
+
+            void Swap(OpenHashTable& other)
+            {
+                std::swap(m_states, other.m_states);
+                std::swap(m_slots, other.m_slots);
+                std::swap(m_capacity, other.m_capacity);
+                std::swap(m_size, other.m_size);
+                std::swap(m_erased, other.m_erased);
+                std::swap(m_shift, other.m_shift);
+            }
+
+            uint8* m_states;
+            StorageType* m_slots;
+            size_type m_capacity;                               // power of two, or 0 before the first insert
+            size_type m_size;
+            size_type m_erased;
+            uint32 m_shift;                                     // 64 - log2(m_capacity)
+    };
+
+    struct OpenHashMapKey
+    {
+        template<class Pair>
+        typename Pair::first_type const& operator()(Pair const& value) const { return value.first; }
+    };
+
+    struct OpenHashSetKey
+    {
+        template<class Key>
+        Key const& operator()(Key const& value) const { return value; }
+    };
+
+    template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+    class OpenHashMap : public OpenHashTable<Key, std::pair<Key const, Value>, OpenHashMapKey, Hash, KeyEqual>
+    {
+            typedef OpenHashTable<Key, std::pair<Key const, Value>, OpenHashMapKey, Hash, KeyEqual> Base;
+
+        public:
+            typedef Value mapped_type;
+
+            template<class... Args>
+            std::pair<typename Base::iterator, bool> try_emplace(Key const& key, Args&&... args)
+            {
+                return Base::Emplace(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+
+            Value& operator[](Key const& key) { return try_emplace(key).first->second; }
+    };
+
+    template<class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+    class OpenHashSet : public OpenHashTable<Key, Key const, OpenHashSetKey, Hash, KeyEqual>
+    {
+    };
+}
+
+#endif